@@ -72,14 +72,13 @@ def generate_wrappers(target):
 
 def generate_virtual_version(argcount, const=False, returns=False):
     s = """#define GDVIRTUAL$VER($RET m_name $ARG)\\
-	::godot::StringName _gdvirtual_##m_name##_sn = #m_name;\\
 	template <bool required>\\
 	_FORCE_INLINE_ bool _gdvirtual_##m_name##_call($CALLARGS) $CONST {\\
-		if (::godot::internal::gdextension_interface_object_has_script_method(_owner, &_gdvirtual_##m_name##_sn)) { \\
+		if (::godot::internal::gdextension_interface_object_has_script_method(_owner, SNAME(#m_name)._native_ptr())) { \\
 			GDExtensionCallError ce;\\
 			$CALLSIARGS\\
 			::godot::Variant ret;\\
-			::godot::internal::gdextension_interface_object_call_script_method(_owner, &_gdvirtual_##m_name##_sn, $CALLSIARGPASS, &ret, &ce);\\
+			::godot::internal::gdextension_interface_object_call_script_method(_owner, SNAME(#m_name)._native_ptr(), $CALLSIARGPASS, &ret, &ce);\\
 			if (ce.error == GDEXTENSION_CALL_OK) {\\
 				$CALLSIRET\\
 				return true;\\
@@ -92,7 +91,7 @@ def generate_virtual_version(argcount, const=False, returns=False):
 		return false;\\
 	}\\
 	_FORCE_INLINE_ bool _gdvirtual_##m_name##_overridden() const {\\
-		return ::godot::internal::gdextension_interface_object_has_script_method(_owner, &_gdvirtual_##m_name##_sn); \\
+		return ::godot::internal::gdextension_interface_object_has_script_method(_owner, SNAME(#m_name)._native_ptr()); \\
 	}\\
 	_FORCE_INLINE_ static ::godot::MethodInfo _gdvirtual_##m_name##_get_method_info() {\\
 		::godot::MethodInfo method_info;\\
@@ -274,14 +273,21 @@ def print_file_list(api_filepath, output_dir, headers=False, sources=False):
     print(*get_file_list(api_filepath, output_dir, headers, sources), sep=";", end=None)
 
 
-def generate_bindings(api_filepath, use_template_get_node, bits="64", precision="single", output_dir="."):
+def generate_bindings(
+    api_filepath, use_template_get_node, bits="64", precision="single", output_dir=".", eager_method_binds=False
+):
     api = {}
     with open(api_filepath, encoding="utf-8") as api_file:
         api = json.load(api_file)
-    _generate_bindings(api, use_template_get_node, bits, precision, output_dir)
+    # CMake passes options as strings.
+    if isinstance(eager_method_binds, str):
+        eager_method_binds = eager_method_binds.lower() in ("true", "on", "1")
+    _generate_bindings(api, use_template_get_node, bits, precision, output_dir, eager_method_binds)
 
 
-def _generate_bindings(api, use_template_get_node, bits="64", precision="single", output_dir="."):
+def _generate_bindings(
+    api, use_template_get_node, bits="64", precision="single", output_dir=".", eager_method_binds=False
+):
     target_dir = Path(output_dir) / "gen"
 
     shutil.rmtree(target_dir, ignore_errors=True)
@@ -294,7 +300,7 @@ def _generate_bindings(api, use_template_get_node, bits="64", precision="single"
     generate_version_header(api, target_dir)
     generate_global_constant_binds(api, target_dir)
     generate_builtin_bindings(api, target_dir, real_t + "_" + bits)
-    generate_engine_classes_bindings(api, target_dir, use_template_get_node)
+    generate_engine_classes_bindings(api, target_dir, use_template_get_node, eager_method_binds)
     generate_utility_functions(api, target_dir)
 
 
@@ -551,6 +557,7 @@ def generate_builtin_class_header(builtin_api, size, used_classes, fully_used_cl
 
     if is_packed_array(class_name):
         result.append("#include <godot_cpp/core/error_macros.hpp>")
+        result.append("#include <godot_cpp/templates/span.hpp>")
         result.append("#include <initializer_list>")
         result.append("")
 
@@ -614,9 +621,11 @@ def generate_builtin_class_header(builtin_api, size, used_classes, fully_used_cl
     if builtin_api["has_destructor"]:
         result.append("\t\tGDExtensionPtrDestructor destructor;")
 
+    # Other methods are resolved on first call, see generate_builtin_class_source().
     if "methods" in builtin_api:
         for method in builtin_api["methods"]:
-            result.append(f'\t\tGDExtensionPtrBuiltInMethod method_{method["name"]};')
+            if method["is_vararg"]:
+                result.append(f'\t\tGDExtensionPtrBuiltInMethod method_{method["name"]};')
 
     if "members" in builtin_api:
         for member in builtin_api["members"]:
@@ -886,17 +895,29 @@ def generate_builtin_class_header(builtin_api, size, used_classes, fully_used_cl
 	};
 
 	_FORCE_INLINE_ Iterator begin() {
-		return Iterator(ptrw());
+		return Iterator(mut_view().begin());
 	}
 	_FORCE_INLINE_ Iterator end() {
-		return Iterator(ptrw() + size());
+		return Iterator(mut_view().end());
 	}
 
+	// Iterating a const array never copies on write.
 	_FORCE_INLINE_ ConstIterator begin() const {
-		return ConstIterator(ptr());
+		return ConstIterator(view().begin());
 	}
 	_FORCE_INLINE_ ConstIterator end() const {
-		return ConstIterator(ptr() + size());
+		return ConstIterator(view().end());
+	}
+
+	// Views fetch the data pointer once; indexing them is plain pointer arithmetic.
+	// They are invalidated when the array is resized or copied on write.
+	_FORCE_INLINE_ Span<const $TYPE> view() const {
+		int64_t count = size();
+		return Span<const $TYPE>(count ? ptr() : nullptr, count);
+	}
+	_FORCE_INLINE_ Span<$TYPE> mut_view() {
+		int64_t count = size();
+		return Span<$TYPE>(count ? ptrw() : nullptr, count);
 	}"""
         result.append(iterators.replace("$TYPE", return_type))
         init_list = """
@@ -1021,15 +1042,17 @@ def generate_builtin_class_source(builtin_api, size, used_classes, fully_used_cl
         result.append("\tString::_init_bindings_constructors_destructor();")
     result.append(f"\t{class_name}::_init_bindings_constructors_destructor();")
 
-    result.append("\tStringName _gde_name;")
+    # Vararg methods are templates in builtin_vararg_methods.hpp, so only they go through the table.
+    vararg_methods = [method for method in builtin_api.get("methods", []) if method["is_vararg"]]
+    if len(vararg_methods) > 0 or "members" in builtin_api:
+        result.append("\tStringName _gde_name;")
 
-    if "methods" in builtin_api:
-        for method in builtin_api["methods"]:
-            # TODO: Add error check for hash mismatch.
-            result.append(f'\t_gde_name = StringName("{method["name"]}");')
-            result.append(
-                f'\t_method_bindings.method_{method["name"]} = internal::gdextension_interface_variant_get_ptr_builtin_method({enum_type_name}, _gde_name._native_ptr(), {method["hash"]});'
-            )
+    for method in vararg_methods:
+        # TODO: Add error check for hash mismatch.
+        result.append(f'\t_gde_name = StringName("{method["name"]}");')
+        result.append(
+            f'\t_method_bindings.method_{method["name"]} = internal::gdextension_interface_variant_get_ptr_builtin_method({enum_type_name}, _gde_name._native_ptr(), {method["hash"]});'
+        )
 
     if "members" in builtin_api:
         for member in builtin_api["members"]:
@@ -1151,6 +1174,17 @@ def generate_builtin_class_source(builtin_api, size, used_classes, fully_used_cl
             method_signature = make_signature(class_name, method, for_builtin=True)
             result.append(method_signature + " {")
 
+            # Looked up on first call, most builtin methods are never used by a given extension.
+            result.append(
+                f'\tstatic GDExtensionPtrBuiltInMethod _gde_method = internal::gdextension_interface_variant_get_ptr_builtin_method({enum_type_name}, StringName("{method["name"]}")._native_ptr(), {method["hash"]});'
+            )
+            if "return_type" in method:
+                result.append(
+                    f'\tCHECK_METHOD_BIND_RET(_gde_method, {get_default_value_for_type(method["return_type"])});'
+                )
+            else:
+                result.append("\tCHECK_METHOD_BIND(_gde_method);")
+
             method_call = "\t"
             is_ref = False
 
@@ -1167,7 +1201,7 @@ def generate_builtin_class_source(builtin_api, size, used_classes, fully_used_cl
                     method_call += f"return internal::_call_builtin_method_ptr_ret_obj<{return_type}>("
             else:
                 method_call += "internal::_call_builtin_method_ptr_no_ret("
-            method_call += f'_method_bindings.method_{method["name"]}, '
+            method_call += "_gde_method, "
             if "is_static" in method and method["is_static"]:
                 method_call += "nullptr"
             else:
@@ -1273,7 +1307,7 @@ def generate_builtin_class_source(builtin_api, size, used_classes, fully_used_cl
     return "\n".join(result)
 
 
-def generate_engine_classes_bindings(api, output_dir, use_template_get_node):
+def generate_engine_classes_bindings(api, output_dir, use_template_get_node, eager_method_binds=False):
     global engine_classes
     global singletons
     global native_structures
@@ -1468,7 +1502,9 @@ def generate_engine_classes_bindings(api, output_dir, use_template_get_node):
 
         with source_filename.open("w+", encoding="utf-8") as source_file:
             source_file.write(
-                generate_engine_class_source(class_api, used_classes, fully_used_classes, use_template_get_node)
+                generate_engine_class_source(
+                    class_api, used_classes, fully_used_classes, use_template_get_node, eager_method_binds
+                )
             )
 
     for native_struct in api["native_structures"]:
@@ -1850,7 +1886,9 @@ def generate_engine_class_header(class_api, used_classes, fully_used_classes, us
     return "\n".join(result)
 
 
-def generate_engine_class_source(class_api, used_classes, fully_used_classes, use_template_get_node):
+def generate_engine_class_source(
+    class_api, used_classes, fully_used_classes, use_template_get_node, eager_method_binds=False
+):
     global singletons
     result = []
 
@@ -1917,11 +1955,25 @@ def generate_engine_class_source(class_api, used_classes, fully_used_classes, us
         result.append("")
 
     if "methods" in class_api:
-        for method in class_api["methods"]:
-            if method["is_virtual"]:
-                # Will be done later
-                continue
+        bound_methods = [method for method in class_api["methods"] if not method["is_virtual"]]
+        if eager_method_binds and len(bound_methods) > 0:
+            engine_class_name = class_api.get("alias_for", class_name)
+            level = "EDITOR" if class_api["api_type"] == "editor" else "SCENE"
+            result.append("static const char *const _gde_method_names[] = {")
+            for method in bound_methods:
+                result.append(f'\t"{method["name"]}",')
+            result.append("};")
+            result.append("static const GDExtensionInt _gde_method_hashes[] = {")
+            for method in bound_methods:
+                result.append(f"\t{method['hash']},")
+            result.append("};")
+            result.append(f"static std::atomic<GDExtensionMethodBindPtr> _gde_method_binds[{len(bound_methods)}];")
+            result.append(
+                f'static internal::EngineMethodBindTable _gde_method_bind_table("{engine_class_name}", GDEXTENSION_INITIALIZATION_{level}, {len(bound_methods)}, _gde_method_names, _gde_method_hashes, _gde_method_binds);'
+            )
+            result.append("")
 
+        for method_index, method in enumerate(bound_methods):
             vararg = "is_vararg" in method and method["is_vararg"]
 
             # Method signature.
@@ -1929,9 +1981,14 @@ def generate_engine_class_source(class_api, used_classes, fully_used_classes, us
             result.append(method_signature + " {")
 
             # Method body.
-            result.append(
-                f'\tstatic GDExtensionMethodBindPtr _gde_method_bind = internal::gdextension_interface_classdb_get_method_bind({class_name}::get_class_static()._native_ptr(), StringName("{method["name"]}")._native_ptr(), {method["hash"]});'
-            )
+            if eager_method_binds:
+                result.append(
+                    f"\tGDExtensionMethodBindPtr _gde_method_bind = _gde_method_bind_table.get({method_index});"
+                )
+            else:
+                result.append(
+                    f'\tstatic GDExtensionMethodBindPtr _gde_method_bind = internal::gdextension_interface_classdb_get_method_bind({class_name}::get_class_static()._native_ptr(), StringName("{method["name"]}")._native_ptr(), {method["hash"]});'
+                )
             method_call = "\t"
             has_return = "return_value" in method and method["return_value"]["type"] != "void"
 
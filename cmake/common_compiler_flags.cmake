@@ -152,6 +152,8 @@ function( common_compiler_flags )
 
             $<${HOT_RELOAD}:HOT_RELOAD_ENABLED>
 
+            $<$<BOOL:${GODOT_STARTUP_PROFILING}>:STARTUP_PROFILING_ENABLED>
+
             $<$<STREQUAL:${GODOT_PRECISION},double>:REAL_T_IS_DOUBLE>
 
             $<${IS_MSVC}:$<${DISABLE_EXCEPTIONS}:_HAS_EXCEPTIONS=0>>
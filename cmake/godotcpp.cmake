@@ -97,6 +97,9 @@ function( godotcpp_options )
     option(GODOT_GENERATE_TEMPLATE_GET_NODE
             "Generate a template version of the Node class's get_node. (ON|OFF)" ON)
 
+    option(GODOT_EAGER_METHOD_BINDS
+            "Resolve all engine method binds in one pass at initialization, instead of on first call. (ON|OFF)" OFF)
+
     #TODO build_library
 
     set(GODOT_PRECISION "single" CACHE STRING
@@ -117,6 +120,9 @@ function( godotcpp_options )
     set(GODOT_USE_HOT_RELOAD "" CACHE BOOL
             "Enable the extra accounting required to support hot reload. (ON|OFF)")
 
+    option(GODOT_STARTUP_PROFILING
+            "Time the extension initialization phases and print a JSON report after each initialization level. (ON|OFF)" OFF)
+
     # Disable exception handling. Godot doesn't use exceptions anywhere, and this
     # saves around 20% of binary size and very significant build time (GH-80513).
     option(GODOT_DISABLE_EXCEPTIONS "Force disabling exception handling code (ON|OFF)" ON )
@@ -203,6 +209,11 @@ function( godotcpp_generate )
         set( USE_TEMPLATE_GET_NODE "True" )
     endif()
 
+    set( EAGER_METHOD_BINDS "False" )
+    if( GODOT_EAGER_METHOD_BINDS )
+        set( EAGER_METHOD_BINDS "True" )
+    endif()
+
     # Bits (32|64)
     math( EXPR BITS "${CMAKE_SIZEOF_VOID_P} * 8" ) # CMAKE_SIZEOF_VOID_P refers to target architecture.
 
@@ -236,7 +247,8 @@ function( godotcpp_generate )
             "${USE_TEMPLATE_GET_NODE}"
             "${BITS}"
             "${GODOT_PRECISION}"
-            "${CMAKE_CURRENT_BINARY_DIR}" )
+            "${CMAKE_CURRENT_BINARY_DIR}"
+            "${EAGER_METHOD_BINDS}" )
 
     ### Platform is derived from the toolchain target
     # See GeneratorExpressions PLATFORM_ID and CMAKE_SYSTEM_NAME
@@ -76,7 +76,7 @@ endfunction(  )
 Using the generated file list, use the binding_generator.py to generate the
 godot-cpp bindings. This will run at build time only if there are files
 missing. ]]
-function( binding_generator_generate_bindings API_FILE USE_TEMPLATE_GET_NODE, BITS, PRECISION, OUTPUT_DIR )
+function( binding_generator_generate_bindings API_FILE USE_TEMPLATE_GET_NODE BITS PRECISION OUTPUT_DIR EAGER_METHOD_BINDS )
     # This code snippet will be squashed into a single line
     set( PYTHON_SCRIPT
 "from binding_generator import generate_bindings"
@@ -85,7 +85,8 @@ function( binding_generator_generate_bindings API_FILE USE_TEMPLATE_GET_NODE, BI
     use_template_get_node='${USE_TEMPLATE_GET_NODE}',
     bits='${BITS}',
     precision='${PRECISION}',
-    output_dir='${OUTPUT_DIR}')")
+    output_dir='${OUTPUT_DIR}',
+    eager_method_binds='${EAGER_METHOD_BINDS}')")
 
     message( DEBUG "Python:\n${PYTHON_SCRIPT}" )
 
@@ -38,8 +38,12 @@
 #include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
+#include <godot_cpp/variant/string_name_literal.hpp>
+
 #include <godot_cpp/godot.hpp>
 
+#include <atomic>
+
 #if defined(MACOS_ENABLED) && defined(HOT_RELOAD_ENABLED)
 #include <mutex>
 #define _GODOT_CPP_AVOID_THREAD_LOCAL
@@ -117,6 +121,8 @@ protected:
 	virtual ~Wrapped() {}
 
 public:
+	static constexpr bool _gde_is_extension_class = false;
+
 	static const StringName &get_class_static() {
 		static const StringName string_name = StringName("Wrapped");
 		return string_name;
@@ -179,6 +185,34 @@ struct EngineClassRegistration {
 	}
 };
 
+// Method binds of one engine class, generated when the bindings are built
+// with eager method binds. All tables of a level are resolved in a single
+// pass when that level initializes, so calls only load from the table.
+struct EngineMethodBindTable {
+	const char *class_name;
+	GDExtensionInitializationLevel level;
+	uint32_t count;
+	const char *const *method_names;
+	const GDExtensionInt *method_hashes;
+	std::atomic<GDExtensionMethodBindPtr> *method_binds;
+
+	EngineMethodBindTable(const char *p_class_name, GDExtensionInitializationLevel p_level, uint32_t p_count, const char *const *p_method_names, const GDExtensionInt *p_method_hashes, std::atomic<GDExtensionMethodBindPtr> *p_method_binds);
+
+	GDExtensionMethodBindPtr resolve(uint32_t p_index);
+
+	_FORCE_INLINE_ GDExtensionMethodBindPtr get(uint32_t p_index) {
+		GDExtensionMethodBindPtr method_bind = method_binds[p_index].load(std::memory_order_relaxed);
+		if (unlikely(method_bind == nullptr)) {
+			// Called before the level of this class was initialized.
+			method_bind = resolve(p_index);
+		}
+		return method_bind;
+	}
+};
+
+void resolve_engine_method_binds(GDExtensionInitializationLevel p_level);
+void clear_engine_method_binds(GDExtensionInitializationLevel p_level);
+
 } // namespace internal
 
 } // namespace godot
@@ -407,6 +441,8 @@ public:
 		_gde_binding_reference_callback,                                                                                                                                               \
 	};                                                                                                                                                                                 \
                                                                                                                                                                                        \
+	static constexpr bool _gde_is_extension_class = true;                                                                                                                              \
+                                                                                                                                                                                       \
 private:
 
 // Don't use this for your classes, use GDCLASS() instead.
@@ -470,8 +506,7 @@ public:
 	static void initialize_class() {}                                                                                                                                                  \
                                                                                                                                                                                        \
 	static const ::godot::StringName &get_class_static() {                                                                                                                             \
-		static const ::godot::StringName string_name = ::godot::StringName(#m_alias_for);                                                                                              \
-		return string_name;                                                                                                                                                            \
+		return SNAME(#m_alias_for);                                                                                                                                                    \
 	}                                                                                                                                                                                  \
                                                                                                                                                                                        \
 	static const ::godot::StringName &get_parent_class_static() {                                                                                                                      \
@@ -144,17 +144,23 @@ struct VariantObjectClassChecker<const Ref<T> &> {
 	}
 };
 
+template <typename T>
+_FORCE_INLINE_ void validate_variant_argument(const Variant **p_args, uint32_t p_arg_idx, GDExtensionCallError &r_error) {
+	GDExtensionVariantType argtype = GDExtensionVariantType(GetTypeInfo<T>::VARIANT_TYPE);
+	GDExtensionVariantType type = static_cast<GDExtensionVariantType>(p_args[p_arg_idx]->get_type());
+	// Exact matches and Variant parameters are the common case, and don't need to ask the engine.
+	bool can_convert = type == argtype || argtype == GDEXTENSION_VARIANT_TYPE_NIL || internal::gdextension_interface_variant_can_convert_strict(type, argtype);
+	if (!can_convert || !VariantObjectClassChecker<T>::check(*p_args[p_arg_idx])) {
+		r_error.error = GDEXTENSION_CALL_ERROR_INVALID_ARGUMENT;
+		r_error.argument = p_arg_idx;
+		r_error.expected = argtype;
+	}
+}
+
 template <typename T>
 struct VariantCasterAndValidate {
 	static _FORCE_INLINE_ T cast(const Variant **p_args, uint32_t p_arg_idx, GDExtensionCallError &r_error) {
-		GDExtensionVariantType argtype = GDExtensionVariantType(GetTypeInfo<T>::VARIANT_TYPE);
-		if (!internal::gdextension_interface_variant_can_convert_strict(static_cast<GDExtensionVariantType>(p_args[p_arg_idx]->get_type()), argtype) ||
-				!VariantObjectClassChecker<T>::check(p_args[p_arg_idx])) {
-			r_error.error = GDEXTENSION_CALL_ERROR_INVALID_ARGUMENT;
-			r_error.argument = p_arg_idx;
-			r_error.expected = argtype;
-		}
-
+		validate_variant_argument<T>(p_args, p_arg_idx, r_error);
 		return VariantCaster<T>::cast(*p_args[p_arg_idx]);
 	}
 };
@@ -162,14 +168,7 @@ struct VariantCasterAndValidate {
 template <typename T>
 struct VariantCasterAndValidate<T &> {
 	static _FORCE_INLINE_ T cast(const Variant **p_args, uint32_t p_arg_idx, GDExtensionCallError &r_error) {
-		GDExtensionVariantType argtype = GDExtensionVariantType(GetTypeInfo<T>::VARIANT_TYPE);
-		if (!internal::gdextension_interface_variant_can_convert_strict(static_cast<GDExtensionVariantType>(p_args[p_arg_idx]->get_type()), argtype) ||
-				!VariantObjectClassChecker<T>::check(p_args[p_arg_idx])) {
-			r_error.error = GDEXTENSION_CALL_ERROR_INVALID_ARGUMENT;
-			r_error.argument = p_arg_idx;
-			r_error.expected = argtype;
-		}
-
+		validate_variant_argument<T>(p_args, p_arg_idx, r_error);
 		return VariantCaster<T>::cast(*p_args[p_arg_idx]);
 	}
 };
@@ -177,14 +176,7 @@ struct VariantCasterAndValidate<T &> {
 template <typename T>
 struct VariantCasterAndValidate<const T &> {
 	static _FORCE_INLINE_ T cast(const Variant **p_args, uint32_t p_arg_idx, GDExtensionCallError &r_error) {
-		GDExtensionVariantType argtype = GDExtensionVariantType(GetTypeInfo<T>::VARIANT_TYPE);
-		if (!internal::gdextension_interface_variant_can_convert_strict(static_cast<GDExtensionVariantType>(p_args[p_arg_idx]->get_type()), argtype) ||
-				!VariantObjectClassChecker<T>::check(p_args[p_arg_idx])) {
-			r_error.error = GDEXTENSION_CALL_ERROR_INVALID_ARGUMENT;
-			r_error.argument = p_arg_idx;
-			r_error.expected = argtype;
-		}
-
+		validate_variant_argument<T>(p_args, p_arg_idx, r_error);
 		return VariantCaster<T>::cast(*p_args[p_arg_idx]);
 	}
 };
@@ -351,15 +343,14 @@ void call_with_variant_args_dv(T *p_instance, void (T::*p_method)(P...), const G
 	}
 #endif
 
-	Variant args[sizeof...(P) == 0 ? 1 : sizeof...(P)]; // Avoid zero sized array.
+	// The caller's arguments and the defaults outlive the call, so they are used in place instead of copied.
 	std::array<const Variant *, sizeof...(P)> argsp;
 	for (int32_t i = 0; i < (int32_t)sizeof...(P); i++) {
 		if (i < p_argcount) {
-			args[i] = Variant(p_args[i]);
+			argsp[i] = reinterpret_cast<const Variant *>(p_args[i]);
 		} else {
-			args[i] = default_values[i - p_argcount + (dvs - missing)];
+			argsp[i] = &default_values[i - p_argcount + (dvs - missing)];
 		}
-		argsp[i] = &args[i];
 	}
 
 	call_with_variant_args_helper(p_instance, p_method, argsp.data(), r_error, BuildIndexSequence<sizeof...(P)>{});
@@ -386,15 +377,13 @@ void call_with_variant_argsc_dv(T *p_instance, void (T::*p_method)(P...) const,
 	}
 #endif
 
-	Variant args[sizeof...(P) == 0 ? 1 : sizeof...(P)]; // Avoid zero sized array.
 	std::array<const Variant *, sizeof...(P)> argsp;
 	for (int32_t i = 0; i < (int32_t)sizeof...(P); i++) {
 		if (i < p_argcount) {
-			args[i] = Variant(p_args[i]);
+			argsp[i] = reinterpret_cast<const Variant *>(p_args[i]);
 		} else {
-			args[i] = default_values[i - p_argcount + (dvs - missing)];
+			argsp[i] = &default_values[i - p_argcount + (dvs - missing)];
 		}
-		argsp[i] = &args[i];
 	}
 
 	call_with_variant_argsc_helper(p_instance, p_method, argsp.data(), r_error, BuildIndexSequence<sizeof...(P)>{});
@@ -421,15 +410,13 @@ void call_with_variant_args_ret_dv(T *p_instance, R (T::*p_method)(P...), const
 	}
 #endif
 
-	Variant args[sizeof...(P) == 0 ? 1 : sizeof...(P)]; // Avoid zero sized array.
 	std::array<const Variant *, sizeof...(P)> argsp;
 	for (int32_t i = 0; i < (int32_t)sizeof...(P); i++) {
 		if (i < p_argcount) {
-			args[i] = Variant(p_args[i]);
+			argsp[i] = reinterpret_cast<const Variant *>(p_args[i]);
 		} else {
-			args[i] = default_values[i - p_argcount + (dvs - missing)];
+			argsp[i] = &default_values[i - p_argcount + (dvs - missing)];
 		}
-		argsp[i] = &args[i];
 	}
 
 	call_with_variant_args_ret_helper(p_instance, p_method, argsp.data(), r_ret, r_error, BuildIndexSequence<sizeof...(P)>{});
@@ -456,15 +443,13 @@ void call_with_variant_args_retc_dv(T *p_instance, R (T::*p_method)(P...) const,
 	}
 #endif
 
-	Variant args[sizeof...(P) == 0 ? 1 : sizeof...(P)]; // Avoid zero sized array.
 	std::array<const Variant *, sizeof...(P)> argsp;
 	for (int32_t i = 0; i < (int32_t)sizeof...(P); i++) {
 		if (i < p_argcount) {
-			args[i] = Variant(p_args[i]);
+			argsp[i] = reinterpret_cast<const Variant *>(p_args[i]);
 		} else {
-			args[i] = default_values[i - p_argcount + (dvs - missing)];
+			argsp[i] = &default_values[i - p_argcount + (dvs - missing)];
 		}
-		argsp[i] = &args[i];
 	}
 
 	call_with_variant_args_retc_helper(p_instance, p_method, argsp.data(), r_ret, r_error, BuildIndexSequence<sizeof...(P)>{});
@@ -477,24 +462,20 @@ void call_with_variant_args_retc_dv(T *p_instance, R (T::*p_method)(P...) const,
 #pragma GCC diagnostic ignored "-Wunused-but-set-parameter"
 #endif
 
-template <typename Q>
-void call_get_argument_type_helper(int p_arg, int &index, GDExtensionVariantType &type) {
-	if (p_arg == index) {
-		type = GDExtensionVariantType(GetTypeInfo<Q>::VARIANT_TYPE);
-	}
-	index++;
-}
+// Types and metadata of a signature's arguments, built at compile time once per signature.
+template <typename... P>
+struct ArgumentInfoTable {
+	// One extra element avoids zero sized arrays.
+	static constexpr GDExtensionVariantType types[sizeof...(P) + 1] = { GDExtensionVariantType(GetTypeInfo<P>::VARIANT_TYPE)..., GDEXTENSION_VARIANT_TYPE_NIL };
+	static constexpr GDExtensionClassMethodArgumentMetadata metadata[sizeof...(P) + 1] = { GetTypeInfo<P>::METADATA..., GDEXTENSION_METHOD_ARGUMENT_METADATA_NONE };
+};
 
 template <typename... P>
 GDExtensionVariantType call_get_argument_type(int p_arg) {
-	GDExtensionVariantType type = GDEXTENSION_VARIANT_TYPE_NIL;
-	int index = 0;
-	// I think rocket science is simpler than modern C++.
-	using expand_type = int[];
-	expand_type a{ 0, (call_get_argument_type_helper<P>(p_arg, index, type), 0)... };
-	(void)a; // Suppress (valid, but unavoidable) -Wunused-variable warning.
-	(void)index; // Suppress GCC warning.
-	return type;
+	if (p_arg < 0 || p_arg >= (int)sizeof...(P)) {
+		return GDEXTENSION_VARIANT_TYPE_NIL;
+	}
+	return ArgumentInfoTable<P...>::types[p_arg];
 }
 
 template <typename Q>
@@ -515,25 +496,12 @@ void call_get_argument_type_info(int p_arg, PropertyInfo &info) {
 	(void)index; // Suppress GCC warning.
 }
 
-template <typename Q>
-void call_get_argument_metadata_helper(int p_arg, int &index, GDExtensionClassMethodArgumentMetadata &md) {
-	if (p_arg == index) {
-		md = GetTypeInfo<Q>::METADATA;
-	}
-	index++;
-}
-
 template <typename... P>
 GDExtensionClassMethodArgumentMetadata call_get_argument_metadata(int p_arg) {
-	GDExtensionClassMethodArgumentMetadata md = GDEXTENSION_METHOD_ARGUMENT_METADATA_NONE;
-
-	int index = 0;
-	// I think rocket science is simpler than modern C++.
-	using expand_type = int[];
-	expand_type a{ 0, (call_get_argument_metadata_helper<P>(p_arg, index, md), 0)... };
-	(void)a; // Suppress (valid, but unavoidable) -Wunused-variable warning.
-	(void)index;
-	return md;
+	if (p_arg < 0 || p_arg >= (int)sizeof...(P)) {
+		return GDEXTENSION_METHOD_ARGUMENT_METADATA_NONE;
+	}
+	return ArgumentInfoTable<P...>::metadata[p_arg];
 }
 
 template <typename... P, size_t... Is>
@@ -568,15 +536,13 @@ void call_with_variant_args_static_dv(void (*p_method)(P...), const GDExtensionC
 	}
 #endif
 
-	Variant args[sizeof...(P) == 0 ? 1 : sizeof...(P)]; // Avoid zero sized array.
 	std::array<const Variant *, sizeof...(P)> argsp;
 	for (int32_t i = 0; i < (int32_t)sizeof...(P); i++) {
 		if (i < p_argcount) {
-			args[i] = Variant(p_args[i]);
+			argsp[i] = reinterpret_cast<const Variant *>(p_args[i]);
 		} else {
-			args[i] = default_values[i - p_argcount + (dvs - missing)];
+			argsp[i] = &default_values[i - p_argcount + (dvs - missing)];
 		}
-		argsp[i] = &args[i];
 	}
 
 	call_with_variant_args_static(p_method, argsp.data(), r_error, BuildIndexSequence<sizeof...(P)>{});
@@ -660,15 +626,13 @@ void call_with_variant_args_static_ret_dv(R (*p_method)(P...), const GDExtension
 	}
 #endif
 
-	Variant args[sizeof...(P) == 0 ? 1 : sizeof...(P)]; // Avoid zero sized array.
 	std::array<const Variant *, sizeof...(P)> argsp;
 	for (int32_t i = 0; i < (int32_t)sizeof...(P); i++) {
 		if (i < p_argcount) {
-			args[i] = Variant(p_args[i]);
+			argsp[i] = reinterpret_cast<const Variant *>(p_args[i]);
 		} else {
-			args[i] = default_values[i - p_argcount + (dvs - missing)];
+			argsp[i] = &default_values[i - p_argcount + (dvs - missing)];
 		}
-		argsp[i] = &args[i];
 	}
 
 	call_with_variant_args_static_ret(p_method, argsp.data(), r_ret, r_error, BuildIndexSequence<sizeof...(P)>{});
@@ -38,6 +38,7 @@
 #include <godot_cpp/core/method_bind.hpp>
 #include <godot_cpp/core/object.hpp>
 #include <godot_cpp/core/print_string.hpp>
+#include <godot_cpp/core/startup_profiler.hpp>
 
 #include <godot_cpp/classes/class_db_singleton.hpp>
 
@@ -93,6 +94,11 @@ public:
 			uint32_t hash;
 		};
 
+		struct VirtualTableEntry {
+			const void *name = nullptr; // Address of the interned method name, null for empty slots.
+			VirtualMethod method;
+		};
+
 		StringName name;
 		StringName parent_name;
 		GDExtensionInitializationLevel level = GDEXTENSION_INITIALIZATION_SCENE;
@@ -103,6 +109,9 @@ public:
 		std::set<StringName> constant_names;
 		// Pointer to the parent custom class, if any. Will be null if the parent class is a Godot class.
 		ClassInfo *parent_ptr = nullptr;
+		// Open addressing table of the virtual methods of this class and its custom parents, built once
+		// the class is registered, so get_virtual_func() doesn't have to walk the hierarchy.
+		std::vector<VirtualTableEntry> virtual_table;
 	};
 
 private:
@@ -115,7 +124,8 @@ private:
 	static std::mutex engine_singletons_mutex;
 
 	static MethodBind *bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const MethodDefinition &method_name, const void **p_defs, int p_defcount);
-	static void initialize_class(const ClassInfo &cl);
+	static void initialize_class(ClassInfo &cl);
+	static void _build_virtual_table(ClassInfo &p_cl);
 	static void bind_method_godot(const StringName &p_class_name, MethodBind *p_method);
 
 	template <typename T, bool is_abstract>
@@ -186,6 +196,10 @@ public:
 	template <typename N, typename M, typename... VarArgs>
 	static MethodBind *bind_method(N p_method_name, M p_method, VarArgs... p_args);
 
+	// Same as above, with the method as a template argument so calls from Godot go through static thunks.
+	template <auto M, typename N, typename... VarArgs>
+	static MethodBind *bind_method(N p_method_name, VarArgs... p_args);
+
 	template <typename N, typename M, typename... VarArgs>
 	static MethodBind *bind_static_method(StringName p_class, N p_method_name, M p_method, VarArgs... p_args);
 
@@ -235,6 +249,9 @@ void ClassDB::_register_class(bool p_virtual, bool p_exposed, bool p_runtime) {
 	static_assert(TypesAreSame<typename T::self_type, T>::value, "Class not declared properly, please use GDCLASS.");
 	static_assert(!FunctionsAreSame<T::self_type::_bind_methods, T::parent_type::_bind_methods>::value, "Class must declare 'static void _bind_methods'.");
 	static_assert(!std::is_abstract_v<T> || is_abstract, "Class is abstract, please use GDREGISTER_ABSTRACT_CLASS.");
+#ifdef STARTUP_PROFILING_ENABLED
+	internal::StartupProfileScope profile_scope("register_class");
+#endif
 	instance_binding_callbacks[T::get_class_static()] = &T::_gde_binding_callbacks;
 
 	// Register this class within our plugin
@@ -247,7 +264,8 @@ void ClassDB::_register_class(bool p_virtual, bool p_exposed, bool p_runtime) {
 		// Assign parent if it is also a custom class
 		cl.parent_ptr = &parent_it->second;
 	}
-	classes[cl.name] = cl;
+	ClassInfo &registered = classes[cl.name];
+	registered = cl;
 	class_register_order.push_back(cl.name);
 
 	// Register this class with Godot
@@ -274,7 +292,7 @@ void ClassDB::_register_class(bool p_virtual, bool p_exposed, bool p_runtime) {
 		&ClassDB::get_virtual_func, // GDExtensionClassGetVirtual get_virtual_func;
 		nullptr, // GDExtensionClassGetVirtualCallData get_virtual_call_data_func;
 		nullptr, // GDExtensionClassCallVirtualWithData call_virtual_func;
-		(void *)&T::get_class_static(), // void *class_userdata;
+		(void *)&registered, // void *class_userdata;
 	};
 
 	internal::gdextension_interface_classdb_register_extension_class4(internal::library, cl.name._native_ptr(), cl.parent_name._native_ptr(), &class_info);
@@ -283,7 +301,11 @@ void ClassDB::_register_class(bool p_virtual, bool p_exposed, bool p_runtime) {
 	T::initialize_class();
 
 	// now register our class within ClassDB within Godot
-	initialize_class(classes[cl.name]);
+	initialize_class(registered);
+
+#ifdef STARTUP_PROFILING_ENABLED
+	internal::StartupProfiler::add_class(registered.name, profile_scope.get_elapsed_usec(), registered.method_map.size());
+#endif
 }
 
 template <typename T>
@@ -317,6 +339,18 @@ MethodBind *ClassDB::bind_method(N p_method_name, M p_method, VarArgs... p_args)
 	return bind_methodfi(METHOD_FLAGS_DEFAULT, bind, p_method_name, sizeof...(p_args) == 0 ? nullptr : (const void **)argptrs, sizeof...(p_args));
 }
 
+template <auto M, typename N, typename... VarArgs>
+MethodBind *ClassDB::bind_method(N p_method_name, VarArgs... p_args) {
+	Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
+	const Variant *argptrs[sizeof...(p_args) + 1];
+	for (uint32_t i = 0; i < sizeof...(p_args); i++) {
+		argptrs[i] = &args[i];
+	}
+	MethodBind *bind = create_method_bind(M);
+	bind->set_call_funcs(&MethodBindThunk<M>::call, &MethodBindThunk<M>::ptrcall);
+	return bind_methodfi(METHOD_FLAGS_DEFAULT, bind, p_method_name, sizeof...(p_args) == 0 ? nullptr : (const void **)argptrs, sizeof...(p_args));
+}
+
 template <typename N, typename M, typename... VarArgs>
 MethodBind *ClassDB::bind_static_method(StringName p_class, N p_method_name, M p_method, VarArgs... p_args) {
 	Variant args[sizeof...(p_args) + 1] = { p_args..., Variant() }; // +1 makes sure zero sized arrays are also supported.
@@ -0,0 +1,260 @@
+/**************************************************************************/
+/*  math_fast.hpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_MATH_FAST_HPP
+#define GODOT_MATH_FAST_HPP
+
+#include <godot_cpp/core/math.hpp>
+#include <godot_cpp/core/simd.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace godot {
+
+namespace Math {
+
+/**
+ * Polynomial and rsqrt based approximations of the Math functions, for hot
+ * loops that can trade a few ulp for speed. Every function comes in float,
+ * double and simd::RealV versions, the vector ones work lane by lane within
+ * the same bounds. Most of the gain is in the vector versions, the scalar ones
+ * are about even with a good libm for sin() and exp() and mostly there to
+ * finish the remainder of vector loops.
+ *
+ * Maximum errors against the exact result, for float:
+ *
+ *   rsqrt(x)       3e-7 relative, for positive normal x
+ *   sin(x), cos(x) 3e-7 absolute, for |x| <= 25000
+ *   atan2(y, x)    4e-7 absolute, atan2(0, 0) is 0
+ *   exp(x)         2e-7 relative, x is clamped to [-87, 88]
+ *
+ * The sign of a zero y is ignored: atan2(-0.0, x) with x < 0 returns +pi,
+ * where libm returns -pi.
+ *
+ * The double versions evaluate the same polynomials, so they stop well short
+ * of double precision: 5e-9 for sin and cos, 4e-8 for atan2 and 4e-9 for exp,
+ * with x clamped to [-708, 709]. rsqrt() of doubles is exact on x86, which has
+ * no double estimate to start from, and within 4e-16 relative on NEON.
+ */
+namespace fast {
+
+template <typename T>
+struct _Scalar {
+	using type = T;
+};
+
+template <>
+struct _Scalar<simd::RealV> {
+	using type = real_t;
+};
+
+template <typename T>
+_ALWAYS_INLINE_ T _c(double p_value) {
+	if constexpr (std::is_same_v<T, simd::RealV>) {
+		return simd::RealV::splat(real_t(p_value));
+	} else {
+		return T(p_value);
+	}
+}
+
+// The operations the approximations are written in, for scalars and simd::RealV.
+
+template <typename T>
+_ALWAYS_INLINE_ T _madd(T p_a, T p_b, T p_c) { return p_a * p_b + p_c; }
+_ALWAYS_INLINE_ simd::RealV _madd(simd::RealV p_a, simd::RealV p_b, simd::RealV p_c) { return fmadd(p_a, p_b, p_c); }
+
+template <typename T>
+_ALWAYS_INLINE_ T _min(T p_a, T p_b) { return p_a < p_b ? p_a : p_b; }
+_ALWAYS_INLINE_ simd::RealV _min(simd::RealV p_a, simd::RealV p_b) { return min(p_a, p_b); }
+
+template <typename T>
+_ALWAYS_INLINE_ T _max(T p_a, T p_b) { return p_a > p_b ? p_a : p_b; }
+_ALWAYS_INLINE_ simd::RealV _max(simd::RealV p_a, simd::RealV p_b) { return max(p_a, p_b); }
+
+template <typename T>
+_ALWAYS_INLINE_ T _abs(T p_a) { return std::abs(p_a); }
+_ALWAYS_INLINE_ simd::RealV _abs(simd::RealV p_a) { return max(p_a, simd::RealV::splat(0) - p_a); }
+
+template <typename T>
+_ALWAYS_INLINE_ bool _lt(T p_a, T p_b) { return p_a < p_b; }
+_ALWAYS_INLINE_ simd::RealV _lt(simd::RealV p_a, simd::RealV p_b) { return cmp_lt(p_a, p_b); }
+
+template <typename T>
+_ALWAYS_INLINE_ T _select(bool p_mask, T p_a, T p_b) { return p_mask ? p_a : p_b; }
+_ALWAYS_INLINE_ simd::RealV _select(simd::RealV p_mask, simd::RealV p_a, simd::RealV p_b) { return select(p_mask, p_a, p_b); }
+
+// Compilers inline rint(), unlike round() and nearbyint().
+template <typename T>
+_ALWAYS_INLINE_ T _round(T p_a) { return std::rint(p_a); }
+_ALWAYS_INLINE_ simd::RealV _round(simd::RealV p_a) { return round(p_a); }
+
+_ALWAYS_INLINE_ float _pow2i(float p_n) { return std::bit_cast<float>(uint32_t(int32_t(p_n) + 127) << 23); }
+_ALWAYS_INLINE_ double _pow2i(double p_n) { return std::bit_cast<double>(uint64_t(int64_t(p_n) + 1023) << 52); }
+_ALWAYS_INLINE_ simd::RealV _pow2i(simd::RealV p_n) { return pow2i(p_n); }
+
+// Three part 2 * pi, q * TAU_HI and q * TAU_MID are exact for |q| < 4096.
+constexpr double _TAU_HI = 6.28125;
+constexpr double _TAU_MID = 0.0019354820251464844;
+constexpr double _TAU_LO = -1.7484556025237907e-07;
+
+// Reduces p_x to [-pi, pi].
+template <typename T>
+_ALWAYS_INLINE_ T _reduce_turns(T p_x) {
+	T q = _round(p_x * _c<T>(1.0 / Math_TAU));
+	T r = _madd(q, _c<T>(-_TAU_HI), p_x);
+	r = _madd(q, _c<T>(-_TAU_MID), r);
+	return _madd(q, _c<T>(-_TAU_LO), r);
+}
+
+// Minimax fit of sin() on [-pi / 2, pi / 2].
+template <typename T>
+_ALWAYS_INLINE_ T _sin_poly(T p_x) {
+	T x2 = p_x * p_x;
+	T p = _madd(x2, _c<T>(2.6000547678e-06), _c<T>(-1.9806615201e-04));
+	p = _madd(x2, p, _c<T>(8.3330172916e-03));
+	p = _madd(x2, p, _c<T>(-1.6666657097e-01));
+	return _madd(p_x * x2, p, p_x);
+}
+
+template <typename T>
+_ALWAYS_INLINE_ T _sin(T p_x) {
+	T r = _reduce_turns(p_x);
+	// Fold onto [-pi / 2, pi / 2], sin(pi - r) == sin(r).
+	r = _min(r, _c<T>(Math_PI) - r);
+	r = _max(r, _c<T>(-Math_PI) - r);
+	return _sin_poly(r);
+}
+
+template <typename T>
+_ALWAYS_INLINE_ T _cos(T p_x) {
+	// cos(r) == sin(pi / 2 - |r|), already in range.
+	return _sin_poly(_c<T>(Math_PI / 2) - _abs(_reduce_turns(p_x)));
+}
+
+template <typename T>
+_ALWAYS_INLINE_ T _atan2(T p_y, T p_x) {
+	T ax = _abs(p_x);
+	T ay = _abs(p_y);
+	T lo = _min(ax, ay);
+	T hi = _max(ax, ay);
+	T a = _select(_lt(_c<T>(0), hi), lo / hi, _c<T>(0));
+
+	// Minimax fit of atan() on [0, 1].
+	T a2 = a * a;
+	T p = _madd(a2, _c<T>(-4.0545674499e-03), _c<T>(2.1862958708e-02));
+	p = _madd(a2, p, _c<T>(-5.5912327930e-02));
+	p = _madd(a2, p, _c<T>(9.6421974095e-02));
+	p = _madd(a2, p, _c<T>(-1.3908629580e-01));
+	p = _madd(a2, p, _c<T>(1.9946565657e-01));
+	p = _madd(a2, p, _c<T>(-3.3329860785e-01));
+	p = _madd(a2, p, _c<T>(9.9999933558e-01));
+	T r = a * p;
+
+	r = _select(_lt(ax, ay), _c<T>(Math_PI / 2) - r, r);
+	r = _select(_lt(p_x, _c<T>(0)), _c<T>(Math_PI) - r, r);
+	return _select(_lt(p_y, _c<T>(0)), _c<T>(0) - r, r);
+}
+
+template <typename T>
+_ALWAYS_INLINE_ T _exp(T p_x) {
+	// Keeps 2^n a normal number.
+	constexpr bool is_float = std::is_same_v<typename _Scalar<T>::type, float>;
+	T x = _min(_max(p_x, _c<T>(is_float ? -87.0 : -708.0)), _c<T>(is_float ? 88.0 : 709.0));
+
+	// exp(x) == 2^n * exp(x - n * ln(2)), with a two part ln(2).
+	T n = _round(x * _c<T>(1.0 / Math_LN2));
+	T r = _madd(n, _c<T>(-0.693359375), x);
+	r = _madd(n, _c<T>(2.1219444005471377e-04), r);
+
+	// Minimax fit of exp() on [-ln(2) / 2, ln(2) / 2].
+	T p = _madd(r, _c<T>(1.3948580827e-03), _c<T>(8.3811092901e-03));
+	p = _madd(r, p, _c<T>(4.1666240713e-02));
+	p = _madd(r, p, _c<T>(1.6666325694e-01));
+	p = _madd(r, p, _c<T>(5.0000000808e-01));
+	p = _madd(r, p, _c<T>(1.0000000647e+00));
+	p = _madd(r, p, _c<T>(1));
+	return p * _pow2i(n);
+}
+
+inline float rsqrt(float p_x) {
+#if defined(GODOT_SIMD_SSE2) || defined(GODOT_SIMD_AVX2)
+	float r = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(p_x)));
+	return r * (1.5f - 0.5f * p_x * r * r);
+#elif defined(GODOT_SIMD_NEON)
+	float r = vget_lane_f32(vrsqrte_f32(vdup_n_f32(p_x)), 0);
+	r = r * (1.5f - 0.5f * p_x * r * r);
+	return r * (1.5f - 0.5f * p_x * r * r);
+#else
+	return 1.0f / std::sqrt(p_x);
+#endif
+}
+
+inline double rsqrt(double p_x) {
+	return 1.0 / std::sqrt(p_x);
+}
+
+inline simd::RealV rsqrt(simd::RealV p_x) {
+	simd::RealV r = rsqrt_estimate(p_x);
+	simd::RealV half_x = simd::RealV::splat(0.5) * p_x;
+	simd::RealV three_halves = simd::RealV::splat(1.5);
+	// Each Newton step about doubles the number of correct bits, refine until
+	// they cover the mantissa (8 bit NEON estimates of doubles take three steps).
+	constexpr int target_bits = std::numeric_limits<real_t>::digits - 2;
+	for (int bits = simd::RealV::RSQRT_ESTIMATE_BITS; bits < target_bits; bits *= 2) {
+		r = r * (three_halves - half_x * r * r);
+	}
+	return r;
+}
+
+inline float sin(float p_x) { return _sin(p_x); }
+inline double sin(double p_x) { return _sin(p_x); }
+inline simd::RealV sin(simd::RealV p_x) { return _sin(p_x); }
+
+inline float cos(float p_x) { return _cos(p_x); }
+inline double cos(double p_x) { return _cos(p_x); }
+inline simd::RealV cos(simd::RealV p_x) { return _cos(p_x); }
+
+inline float atan2(float p_y, float p_x) { return _atan2(p_y, p_x); }
+inline double atan2(double p_y, double p_x) { return _atan2(p_y, p_x); }
+inline simd::RealV atan2(simd::RealV p_y, simd::RealV p_x) { return _atan2(p_y, p_x); }
+
+inline float exp(float p_x) { return _exp(p_x); }
+inline double exp(double p_x) { return _exp(p_x); }
+inline simd::RealV exp(simd::RealV p_x) { return _exp(p_x); }
+
+} // namespace fast
+
+} // namespace Math
+
+} // namespace godot
+
+#endif // GODOT_MATH_FAST_HPP
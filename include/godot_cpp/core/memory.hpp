@@ -80,6 +80,10 @@ public:
 	static void *alloc_static(size_t p_bytes, bool p_pad_align = false);
 	static void *realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align = false);
 	static void free_static(void *p_ptr, bool p_pad_align = false);
+
+	// For SIMD data, see simd::ALIGNMENT. p_alignment must be a power of two, free with free_aligned_static().
+	static void *alloc_aligned_static(size_t p_bytes, size_t p_alignment);
+	static void free_aligned_static(void *p_memory);
 };
 
 template <typename T, std::enable_if_t<!std::is_base_of<::godot::Wrapped, T>::value, bool> = true>
@@ -128,7 +132,12 @@ void memdelete_allocator(T *p_class) {
 		p_class->~T();
 	}
 
-	A::free(p_class);
+	// Allocators that need the size back (like PoolAllocator) get it here.
+	if constexpr (requires { A::free(p_class, sizeof(T)); }) {
+		A::free(p_class, sizeof(T));
+	} else {
+		A::free(p_class);
+	}
 }
 
 class DefaultAllocator {
@@ -145,6 +154,65 @@ public:
 	_ALWAYS_INLINE_ void delete_allocation(T *p_allocation) { memdelete(p_allocation); }
 };
 
+// Size-class pool for small, fixed-size allocations such as container nodes.
+// Blocks are carved out of pages obtained from the engine and recycled through
+// per-thread caches, so most allocations never leave the extension. Pages of a
+// size class are given back when the last level deinitializes, provided every
+// block of that class has been freed by then. Unlike Memory, the size must be
+// passed back when freeing, and blocks are only guaranteed alignof(max_align_t).
+class MemoryPool {
+	MemoryPool();
+
+public:
+	static constexpr size_t GRANULARITY = 16;
+	static constexpr size_t MAX_BLOCK_SIZE = 512; // Larger requests are forwarded to Memory.
+	static constexpr size_t SIZE_CLASS_COUNT = MAX_BLOCK_SIZE / GRANULARITY;
+	static constexpr size_t PAGE_SIZE = 64 * 1024;
+
+	static void *alloc(size_t p_bytes);
+	static void free(void *p_ptr, size_t p_bytes);
+
+	// Returns the pages of every size class with no live blocks to the engine.
+	// Flushes the calling thread's cache first, other threads' caches count as live.
+	static void release_unused_pages();
+	static uint64_t get_reserved_bytes();
+};
+
+static_assert(MemoryPool::GRANULARITY % alignof(max_align_t) == 0);
+
+// Drop-in for DefaultAllocator (List, RBMap, RBSet). Requires sized frees, which memdelete_allocator provides.
+class PoolAllocator {
+public:
+	_ALWAYS_INLINE_ static void *alloc(size_t p_memory) { return MemoryPool::alloc(p_memory); }
+	_ALWAYS_INLINE_ static void free(void *p_ptr, size_t p_memory) { MemoryPool::free(p_ptr, p_memory); }
+};
+
+// Drop-in for DefaultTypedAllocator (HashMap elements).
+template <typename T>
+class PoolTypedAllocator {
+public:
+	template <typename... Args>
+	_ALWAYS_INLINE_ T *new_allocation(const Args &&...p_args) { return memnew_placement(MemoryPool::alloc(sizeof(T)), T(p_args...)); }
+	_ALWAYS_INLINE_ void delete_allocation(T *p_allocation) {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			p_allocation->~T();
+		}
+		MemoryPool::free(p_allocation, sizeof(T));
+	}
+};
+
+// Allocators used by default for node-based containers. Debug builds keep
+// every node visible to the engine's memory tracking.
+#ifdef DEBUG_ENABLED
+typedef DefaultAllocator DefaultNodeAllocator;
+template <typename T>
+using DefaultTypedNodeAllocator = DefaultTypedAllocator<T>;
+#else
+typedef PoolAllocator DefaultNodeAllocator;
+template <typename T>
+using DefaultTypedNodeAllocator = PoolTypedAllocator<T>;
+#endif
+
 #define memnew_arr(m_class, m_count) memnew_arr_template<m_class>(m_count)
 
 _FORCE_INLINE_ uint64_t *_get_element_count_ptr(uint8_t *p_ptr) {
@@ -167,7 +235,8 @@ T *memnew_arr_template(size_t p_elements, const char *p_descr = "") {
 	uint64_t *_elem_count_ptr = _get_element_count_ptr(mem);
 	*(_elem_count_ptr) = p_elements;
 
-	if constexpr (!std::is_trivially_destructible_v<T>) {
+	// Types with default member initializers can still be trivially destructible.
+	if constexpr (!std::is_trivially_constructible_v<T>) {
 		T *elems = (T *)mem;
 
 		/* call operator new */
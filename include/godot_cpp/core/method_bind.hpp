@@ -60,8 +60,12 @@ class MethodBind {
 
 	std::vector<StringName> argument_names;
 	GDExtensionVariantType *argument_types = nullptr;
+	GDExtensionClassMethodArgumentMetadata *argument_metadata = nullptr;
 	std::vector<Variant> default_arguments;
 
+	GDExtensionClassMethodCall call_func = &bind_call;
+	GDExtensionClassMethodPtrCall ptrcall_func = &bind_ptrcall;
+
 protected:
 	virtual GDExtensionVariantType gen_argument_type(int p_arg) const = 0;
 	virtual PropertyInfo gen_argument_type_info(int p_arg) const = 0;
@@ -111,6 +115,14 @@ public:
 	std::vector<StringName> get_argument_names() const;
 	void set_default_arguments(const std::vector<Variant> &p_default_arguments) { default_arguments = p_default_arguments; }
 
+	// The entry points registered with Godot, bind_call and bind_ptrcall unless replaced by static thunks.
+	_FORCE_INLINE_ GDExtensionClassMethodCall get_call_func() const { return call_func; }
+	_FORCE_INLINE_ GDExtensionClassMethodPtrCall get_ptrcall_func() const { return ptrcall_func; }
+	_FORCE_INLINE_ void set_call_funcs(GDExtensionClassMethodCall p_call_func, GDExtensionClassMethodPtrCall p_ptrcall_func) {
+		call_func = p_call_func;
+		ptrcall_func = p_ptrcall_func;
+	}
+
 	_FORCE_INLINE_ GDExtensionVariantType get_argument_type(int p_argument) const {
 		ERR_FAIL_COND_V(p_argument < -1 || p_argument > argument_count, GDEXTENSION_VARIANT_TYPE_NIL);
 		return argument_types[p_argument + 1];
@@ -118,6 +130,8 @@ public:
 
 	PropertyInfo get_argument_info(int p_argument) const;
 	virtual GDExtensionClassMethodArgumentMetadata get_argument_metadata(int p_argument) const = 0;
+	// Metadata of the return value followed by the arguments, computed once at construction.
+	_FORCE_INLINE_ const GDExtensionClassMethodArgumentMetadata *get_arguments_metadata() const { return argument_metadata; }
 
 	std::vector<PropertyInfo> get_arguments_info_list() const {
 		std::vector<PropertyInfo> vec;
@@ -730,6 +744,46 @@ MethodBind *create_static_method_bind(R (*p_method)(P...)) {
 	return a;
 }
 
+// Entry points for a method known at compile time, registered by ClassDB::bind_method<M>() instead of
+// MethodBind::bind_call and bind_ptrcall. They skip the virtual call through the MethodBind, and let the
+// compiler inline the argument conversion into the call. The MethodBind itself is still used for
+// introspection and holds the default arguments.
+template <auto M, typename F = decltype(M)>
+struct MethodBindThunk;
+
+template <auto M, typename T, typename R, typename... P>
+struct MethodBindThunk<M, R (T::*)(P...)> {
+	static void call(void *p_method_userdata, GDExtensionClassInstancePtr p_instance, const GDExtensionConstVariantPtr *p_args, GDExtensionInt p_argument_count, GDExtensionVariantPtr r_return, GDExtensionCallError *r_error) {
+		const MethodBind *bind = reinterpret_cast<const MethodBind *>(p_method_userdata);
+		if constexpr (std::is_void_v<R>) {
+			call_with_variant_args_dv(static_cast<T *>(p_instance), M, p_args, (int)p_argument_count, *r_error, bind->get_default_arguments());
+		} else {
+			// Like in MethodBind::bind_call, r_return is an empty Variant, so the result can be assigned to it directly.
+			call_with_variant_args_ret_dv(static_cast<T *>(p_instance), M, p_args, (int)p_argument_count, *reinterpret_cast<Variant *>(r_return), *r_error, bind->get_default_arguments());
+		}
+	}
+
+	static void ptrcall(void *p_method_userdata, GDExtensionClassInstancePtr p_instance, const GDExtensionConstTypePtr *p_args, GDExtensionTypePtr r_return) {
+		call_with_ptr_args(static_cast<T *>(p_instance), M, p_args, r_return);
+	}
+};
+
+template <auto M, typename T, typename R, typename... P>
+struct MethodBindThunk<M, R (T::*)(P...) const> {
+	static void call(void *p_method_userdata, GDExtensionClassInstancePtr p_instance, const GDExtensionConstVariantPtr *p_args, GDExtensionInt p_argument_count, GDExtensionVariantPtr r_return, GDExtensionCallError *r_error) {
+		const MethodBind *bind = reinterpret_cast<const MethodBind *>(p_method_userdata);
+		if constexpr (std::is_void_v<R>) {
+			call_with_variant_argsc_dv(static_cast<T *>(p_instance), M, p_args, (int)p_argument_count, *r_error, bind->get_default_arguments());
+		} else {
+			call_with_variant_args_retc_dv(static_cast<T *>(p_instance), M, p_args, (int)p_argument_count, *reinterpret_cast<Variant *>(r_return), *r_error, bind->get_default_arguments());
+		}
+	}
+
+	static void ptrcall(void *p_method_userdata, GDExtensionClassInstancePtr p_instance, const GDExtensionConstTypePtr *p_args, GDExtensionTypePtr r_return) {
+		call_with_ptr_args(static_cast<T *>(p_instance), M, p_args, r_return);
+	}
+};
+
 } // namespace godot
 
 #endif // GODOT_METHOD_BIND_HPP
@@ -45,6 +45,7 @@
 
 #include <gdextension_interface.h>
 
+#include <atomic>
 #include <vector>
 
 #define ADD_SIGNAL(m_signal) ::godot::ClassDB::add_signal(get_class_static(), m_signal)
@@ -59,6 +60,18 @@ namespace internal {
 
 Object *get_object_instance_binding(GodotObject *);
 
+// Engine class tags never change, so they are looked up once per type.
+template <typename T>
+void *get_class_tag() {
+	static std::atomic<void *> tag = nullptr;
+	void *result = tag.load(std::memory_order_relaxed);
+	if (unlikely(result == nullptr)) {
+		result = gdextension_interface_classdb_get_class_tag(T::get_class_static()._native_ptr());
+		tag.store(result, std::memory_order_relaxed);
+	}
+	return result;
+}
+
 } // namespace internal
 
 struct MethodInfo {
@@ -126,25 +139,31 @@ T *Object::cast_to(Object *p_object) {
 	if (p_object == nullptr) {
 		return nullptr;
 	}
-	StringName class_name = T::get_class_static();
-	GDExtensionObjectPtr casted = internal::gdextension_interface_object_cast_to(p_object->_owner, internal::gdextension_interface_classdb_get_class_tag(class_name._native_ptr()));
-	if (casted == nullptr) {
+	// Extension instances are the complete C++ object, so their C++ type is authoritative.
+	if (p_object->_is_extension_class()) {
+		return dynamic_cast<T *>(p_object);
+	}
+	if constexpr (T::_gde_is_extension_class) {
+		// Any instance of an extension class would have been caught above.
 		return nullptr;
+	} else {
+		// Engine objects are wrapped as their own class or the closest parent bound in this build,
+		// so a successful C++ cast is always right, while a failed one has to ask the engine.
+		T *result = dynamic_cast<T *>(p_object);
+		if (result != nullptr) {
+			return result;
+		}
+		GDExtensionObjectPtr casted = internal::gdextension_interface_object_cast_to(p_object->_owner, internal::get_class_tag<T>());
+		if (casted == nullptr) {
+			return nullptr;
+		}
+		return dynamic_cast<T *>(internal::get_object_instance_binding(casted));
 	}
-	return dynamic_cast<T *>(internal::get_object_instance_binding(casted));
 }
 
 template <typename T>
 const T *Object::cast_to(const Object *p_object) {
-	if (p_object == nullptr) {
-		return nullptr;
-	}
-	StringName class_name = T::get_class_static();
-	GDExtensionObjectPtr casted = internal::gdextension_interface_object_cast_to(p_object->_owner, internal::gdextension_interface_classdb_get_class_tag(class_name._native_ptr()));
-	if (casted == nullptr) {
-		return nullptr;
-	}
-	return dynamic_cast<const T *>(internal::get_object_instance_binding(casted));
+	return cast_to<T>(const_cast<Object *>(p_object));
 }
 
 } // namespace godot
@@ -0,0 +1,716 @@
+/**************************************************************************/
+/*  simd.hpp                                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_SIMD_HPP
+#define GODOT_SIMD_HPP
+
+#include <godot_cpp/core/defs.hpp>
+
+#include <bit>
+#include <cmath>
+#include <limits>
+
+// The instruction set is picked at compile time from the target flags, build with
+// -mavx2 (/arch:AVX2) to get the AVX2 kernels. Define GODOT_SIMD_DISABLED to force
+// the scalar fallback.
+#if !defined(GODOT_SIMD_DISABLED)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define GODOT_SIMD_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GODOT_SIMD_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define GODOT_SIMD_NEON
+#endif
+#endif
+
+// 32-bit ARM has no double precision NEON.
+#if defined(GODOT_SIMD_NEON) && defined(REAL_T_IS_DOUBLE) && !(defined(__aarch64__) || defined(_M_ARM64))
+#define GODOT_SIMD_REAL_SCALAR
+#elif !defined(GODOT_SIMD_AVX2) && !defined(GODOT_SIMD_SSE2) && !defined(GODOT_SIMD_NEON)
+#define GODOT_SIMD_REAL_SCALAR
+#endif
+
+namespace godot {
+
+namespace simd {
+
+// Arrays aligned to this never split a register load across cache lines, see Memory::alloc_aligned_static().
+#if defined(GODOT_SIMD_AVX2)
+constexpr size_t ALIGNMENT = 32;
+#else
+constexpr size_t ALIGNMENT = 16;
+#endif
+
+/**
+ * A register of real_t lanes, for kernels that process WIDTH elements per
+ * iteration and finish the remainder with the regular scalar math.
+ *
+ * Loads and stores are unaligned. load2()/load3()/load4() and the matching
+ * stores convert between WIDTH interleaved vectors (Vector2, Vector3 and
+ * Vector4 arrays) and one register per component.
+ *
+ * Comparisons return masks with all bits of a lane set or cleared, which
+ * combine with & and | and pick lanes with select(). mask_bits() packs them
+ * to one bit per lane.
+ *
+ * round() rounds to the nearest integer (the SSE2 version converts through
+ * int32, so |x| has to stay below 2^31). pow2i() builds 2^n for integer valued
+ * n in the normal exponent range. rsqrt_estimate() is 1 / sqrt(x) good to
+ * RSQRT_ESTIMATE_BITS bits, Math::fast refines it.
+ */
+
+#if defined(GODOT_SIMD_AVX2) && !defined(REAL_T_IS_DOUBLE)
+
+struct RealV {
+	static constexpr int WIDTH = 8;
+	__m256 v;
+
+	_ALWAYS_INLINE_ static RealV splat(real_t p_value) { return { _mm256_set1_ps(p_value) }; }
+	_ALWAYS_INLINE_ static RealV load(const real_t *p_src) { return { _mm256_loadu_ps(p_src) }; }
+	_ALWAYS_INLINE_ void store(real_t *p_dst) const { _mm256_storeu_ps(p_dst, v); }
+
+	_ALWAYS_INLINE_ RealV operator+(RealV p_other) const { return { _mm256_add_ps(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator-(RealV p_other) const { return { _mm256_sub_ps(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator*(RealV p_other) const { return { _mm256_mul_ps(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator/(RealV p_other) const { return { _mm256_div_ps(v, p_other.v) }; }
+
+	_ALWAYS_INLINE_ friend RealV min(RealV p_a, RealV p_b) { return { _mm256_min_ps(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV max(RealV p_a, RealV p_b) { return { _mm256_max_ps(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV sqrt(RealV p_a) { return { _mm256_sqrt_ps(p_a.v) }; }
+	// p_a * p_b + p_c, fused when the target has FMA.
+	_ALWAYS_INLINE_ friend RealV fmadd(RealV p_a, RealV p_b, RealV p_c) {
+#ifdef __FMA__
+		return { _mm256_fmadd_ps(p_a.v, p_b.v, p_c.v) };
+#else
+		return { _mm256_add_ps(_mm256_mul_ps(p_a.v, p_b.v), p_c.v) };
+#endif
+	}
+
+	_ALWAYS_INLINE_ friend RealV cmp_lt(RealV p_a, RealV p_b) { return { _mm256_cmp_ps(p_a.v, p_b.v, _CMP_LT_OQ) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_le(RealV p_a, RealV p_b) { return { _mm256_cmp_ps(p_a.v, p_b.v, _CMP_LE_OQ) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_gt(RealV p_a, RealV p_b) { return { _mm256_cmp_ps(p_a.v, p_b.v, _CMP_GT_OQ) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_ge(RealV p_a, RealV p_b) { return { _mm256_cmp_ps(p_a.v, p_b.v, _CMP_GE_OQ) }; }
+	_ALWAYS_INLINE_ RealV operator&(RealV p_other) const { return { _mm256_and_ps(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator|(RealV p_other) const { return { _mm256_or_ps(v, p_other.v) }; }
+	_ALWAYS_INLINE_ friend uint32_t mask_bits(RealV p_mask) { return uint32_t(_mm256_movemask_ps(p_mask.v)); }
+	_ALWAYS_INLINE_ friend RealV select(RealV p_mask, RealV p_a, RealV p_b) { return { _mm256_blendv_ps(p_b.v, p_a.v, p_mask.v) }; }
+	_ALWAYS_INLINE_ friend RealV round(RealV p_a) { return { _mm256_round_ps(p_a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+	_ALWAYS_INLINE_ friend RealV pow2i(RealV p_n) { return { _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(p_n.v), _mm256_set1_epi32(127)), 23)) }; }
+
+	static constexpr int RSQRT_ESTIMATE_BITS = 12;
+	_ALWAYS_INLINE_ friend RealV rsqrt_estimate(RealV p_a) { return { _mm256_rsqrt_ps(p_a.v) }; }
+};
+
+#elif defined(GODOT_SIMD_AVX2)
+
+struct RealV {
+	static constexpr int WIDTH = 4;
+	__m256d v;
+
+	_ALWAYS_INLINE_ static RealV splat(real_t p_value) { return { _mm256_set1_pd(p_value) }; }
+	_ALWAYS_INLINE_ static RealV load(const real_t *p_src) { return { _mm256_loadu_pd(p_src) }; }
+	_ALWAYS_INLINE_ void store(real_t *p_dst) const { _mm256_storeu_pd(p_dst, v); }
+
+	_ALWAYS_INLINE_ RealV operator+(RealV p_other) const { return { _mm256_add_pd(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator-(RealV p_other) const { return { _mm256_sub_pd(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator*(RealV p_other) const { return { _mm256_mul_pd(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator/(RealV p_other) const { return { _mm256_div_pd(v, p_other.v) }; }
+
+	_ALWAYS_INLINE_ friend RealV min(RealV p_a, RealV p_b) { return { _mm256_min_pd(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV max(RealV p_a, RealV p_b) { return { _mm256_max_pd(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV sqrt(RealV p_a) { return { _mm256_sqrt_pd(p_a.v) }; }
+	_ALWAYS_INLINE_ friend RealV fmadd(RealV p_a, RealV p_b, RealV p_c) {
+#ifdef __FMA__
+		return { _mm256_fmadd_pd(p_a.v, p_b.v, p_c.v) };
+#else
+		return { _mm256_add_pd(_mm256_mul_pd(p_a.v, p_b.v), p_c.v) };
+#endif
+	}
+
+	_ALWAYS_INLINE_ friend RealV cmp_lt(RealV p_a, RealV p_b) { return { _mm256_cmp_pd(p_a.v, p_b.v, _CMP_LT_OQ) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_le(RealV p_a, RealV p_b) { return { _mm256_cmp_pd(p_a.v, p_b.v, _CMP_LE_OQ) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_gt(RealV p_a, RealV p_b) { return { _mm256_cmp_pd(p_a.v, p_b.v, _CMP_GT_OQ) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_ge(RealV p_a, RealV p_b) { return { _mm256_cmp_pd(p_a.v, p_b.v, _CMP_GE_OQ) }; }
+	_ALWAYS_INLINE_ RealV operator&(RealV p_other) const { return { _mm256_and_pd(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator|(RealV p_other) const { return { _mm256_or_pd(v, p_other.v) }; }
+	_ALWAYS_INLINE_ friend uint32_t mask_bits(RealV p_mask) { return uint32_t(_mm256_movemask_pd(p_mask.v)); }
+	_ALWAYS_INLINE_ friend RealV select(RealV p_mask, RealV p_a, RealV p_b) { return { _mm256_blendv_pd(p_b.v, p_a.v, p_mask.v) }; }
+	_ALWAYS_INLINE_ friend RealV round(RealV p_a) { return { _mm256_round_pd(p_a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) }; }
+	// 2^52 + 1023 + n keeps the biased exponent in the low mantissa bits.
+	_ALWAYS_INLINE_ friend RealV pow2i(RealV p_n) { return { _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(_mm256_add_pd(p_n.v, _mm256_set1_pd(4503599627370496.0 + 1023.0))), 52)) }; }
+
+	// No double precision estimate, this one is exact.
+	static constexpr int RSQRT_ESTIMATE_BITS = 53;
+	_ALWAYS_INLINE_ friend RealV rsqrt_estimate(RealV p_a) { return { _mm256_div_pd(_mm256_set1_pd(1.0), _mm256_sqrt_pd(p_a.v)) }; }
+};
+
+#elif defined(GODOT_SIMD_SSE2) && !defined(REAL_T_IS_DOUBLE)
+
+struct RealV {
+	static constexpr int WIDTH = 4;
+	__m128 v;
+
+	_ALWAYS_INLINE_ static RealV splat(real_t p_value) { return { _mm_set1_ps(p_value) }; }
+	_ALWAYS_INLINE_ static RealV load(const real_t *p_src) { return { _mm_loadu_ps(p_src) }; }
+	_ALWAYS_INLINE_ void store(real_t *p_dst) const { _mm_storeu_ps(p_dst, v); }
+
+	_ALWAYS_INLINE_ RealV operator+(RealV p_other) const { return { _mm_add_ps(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator-(RealV p_other) const { return { _mm_sub_ps(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator*(RealV p_other) const { return { _mm_mul_ps(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator/(RealV p_other) const { return { _mm_div_ps(v, p_other.v) }; }
+
+	_ALWAYS_INLINE_ friend RealV min(RealV p_a, RealV p_b) { return { _mm_min_ps(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV max(RealV p_a, RealV p_b) { return { _mm_max_ps(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV sqrt(RealV p_a) { return { _mm_sqrt_ps(p_a.v) }; }
+	_ALWAYS_INLINE_ friend RealV fmadd(RealV p_a, RealV p_b, RealV p_c) { return { _mm_add_ps(_mm_mul_ps(p_a.v, p_b.v), p_c.v) }; }
+
+	_ALWAYS_INLINE_ friend RealV cmp_lt(RealV p_a, RealV p_b) { return { _mm_cmplt_ps(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_le(RealV p_a, RealV p_b) { return { _mm_cmple_ps(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_gt(RealV p_a, RealV p_b) { return { _mm_cmpgt_ps(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_ge(RealV p_a, RealV p_b) { return { _mm_cmpge_ps(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ RealV operator&(RealV p_other) const { return { _mm_and_ps(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator|(RealV p_other) const { return { _mm_or_ps(v, p_other.v) }; }
+	_ALWAYS_INLINE_ friend uint32_t mask_bits(RealV p_mask) { return uint32_t(_mm_movemask_ps(p_mask.v)); }
+	_ALWAYS_INLINE_ friend RealV select(RealV p_mask, RealV p_a, RealV p_b) { return { _mm_or_ps(_mm_and_ps(p_mask.v, p_a.v), _mm_andnot_ps(p_mask.v, p_b.v)) }; }
+	_ALWAYS_INLINE_ friend RealV round(RealV p_a) { return { _mm_cvtepi32_ps(_mm_cvtps_epi32(p_a.v)) }; }
+	_ALWAYS_INLINE_ friend RealV pow2i(RealV p_n) { return { _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(p_n.v), _mm_set1_epi32(127)), 23)) }; }
+
+	static constexpr int RSQRT_ESTIMATE_BITS = 12;
+	_ALWAYS_INLINE_ friend RealV rsqrt_estimate(RealV p_a) { return { _mm_rsqrt_ps(p_a.v) }; }
+};
+
+#elif defined(GODOT_SIMD_SSE2)
+
+struct RealV {
+	static constexpr int WIDTH = 2;
+	__m128d v;
+
+	_ALWAYS_INLINE_ static RealV splat(real_t p_value) { return { _mm_set1_pd(p_value) }; }
+	_ALWAYS_INLINE_ static RealV load(const real_t *p_src) { return { _mm_loadu_pd(p_src) }; }
+	_ALWAYS_INLINE_ void store(real_t *p_dst) const { _mm_storeu_pd(p_dst, v); }
+
+	_ALWAYS_INLINE_ RealV operator+(RealV p_other) const { return { _mm_add_pd(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator-(RealV p_other) const { return { _mm_sub_pd(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator*(RealV p_other) const { return { _mm_mul_pd(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator/(RealV p_other) const { return { _mm_div_pd(v, p_other.v) }; }
+
+	_ALWAYS_INLINE_ friend RealV min(RealV p_a, RealV p_b) { return { _mm_min_pd(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV max(RealV p_a, RealV p_b) { return { _mm_max_pd(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV sqrt(RealV p_a) { return { _mm_sqrt_pd(p_a.v) }; }
+	_ALWAYS_INLINE_ friend RealV fmadd(RealV p_a, RealV p_b, RealV p_c) { return { _mm_add_pd(_mm_mul_pd(p_a.v, p_b.v), p_c.v) }; }
+
+	_ALWAYS_INLINE_ friend RealV cmp_lt(RealV p_a, RealV p_b) { return { _mm_cmplt_pd(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_le(RealV p_a, RealV p_b) { return { _mm_cmple_pd(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_gt(RealV p_a, RealV p_b) { return { _mm_cmpgt_pd(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_ge(RealV p_a, RealV p_b) { return { _mm_cmpge_pd(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ RealV operator&(RealV p_other) const { return { _mm_and_pd(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator|(RealV p_other) const { return { _mm_or_pd(v, p_other.v) }; }
+	_ALWAYS_INLINE_ friend uint32_t mask_bits(RealV p_mask) { return uint32_t(_mm_movemask_pd(p_mask.v)); }
+	_ALWAYS_INLINE_ friend RealV select(RealV p_mask, RealV p_a, RealV p_b) { return { _mm_or_pd(_mm_and_pd(p_mask.v, p_a.v), _mm_andnot_pd(p_mask.v, p_b.v)) }; }
+	_ALWAYS_INLINE_ friend RealV round(RealV p_a) { return { _mm_cvtepi32_pd(_mm_cvtpd_epi32(p_a.v)) }; }
+	// 2^52 + 1023 + n keeps the biased exponent in the low mantissa bits.
+	_ALWAYS_INLINE_ friend RealV pow2i(RealV p_n) { return { _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(_mm_add_pd(p_n.v, _mm_set1_pd(4503599627370496.0 + 1023.0))), 52)) }; }
+
+	// No double precision estimate, this one is exact.
+	static constexpr int RSQRT_ESTIMATE_BITS = 53;
+	_ALWAYS_INLINE_ friend RealV rsqrt_estimate(RealV p_a) { return { _mm_div_pd(_mm_set1_pd(1.0), _mm_sqrt_pd(p_a.v)) }; }
+};
+
+#elif defined(GODOT_SIMD_NEON) && !defined(REAL_T_IS_DOUBLE)
+
+struct RealV {
+	static constexpr int WIDTH = 4;
+	float32x4_t v;
+
+	_ALWAYS_INLINE_ static RealV splat(real_t p_value) { return { vdupq_n_f32(p_value) }; }
+	_ALWAYS_INLINE_ static RealV load(const real_t *p_src) { return { vld1q_f32(p_src) }; }
+	_ALWAYS_INLINE_ void store(real_t *p_dst) const { vst1q_f32(p_dst, v); }
+
+	_ALWAYS_INLINE_ RealV operator+(RealV p_other) const { return { vaddq_f32(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator-(RealV p_other) const { return { vsubq_f32(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator*(RealV p_other) const { return { vmulq_f32(v, p_other.v) }; }
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+	_ALWAYS_INLINE_ RealV operator/(RealV p_other) const { return { vdivq_f32(v, p_other.v) }; }
+	_ALWAYS_INLINE_ friend RealV sqrt(RealV p_a) { return { vsqrtq_f32(p_a.v) }; }
+	_ALWAYS_INLINE_ friend RealV fmadd(RealV p_a, RealV p_b, RealV p_c) { return { vfmaq_f32(p_c.v, p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV round(RealV p_a) { return { vrndnq_f32(p_a.v) }; }
+#else
+	// ARMv7 has no vector divide or square root, refine the estimates instead.
+	_ALWAYS_INLINE_ RealV operator/(RealV p_other) const {
+		float32x4_t r = vrecpeq_f32(p_other.v);
+		r = vmulq_f32(r, vrecpsq_f32(p_other.v, r));
+		r = vmulq_f32(r, vrecpsq_f32(p_other.v, r));
+		return { vmulq_f32(v, r) };
+	}
+	_ALWAYS_INLINE_ friend RealV sqrt(RealV p_a) {
+		float32x4_t r = vrsqrteq_f32(p_a.v);
+		r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(p_a.v, r), r));
+		r = vmulq_f32(r, vrsqrtsq_f32(vmulq_f32(p_a.v, r), r));
+		// sqrt(0) would be 0 * inf.
+		uint32x4_t zero = vceqq_f32(p_a.v, vdupq_n_f32(0.0f));
+		return { vbslq_f32(zero, p_a.v, vmulq_f32(p_a.v, r)) };
+	}
+	_ALWAYS_INLINE_ friend RealV fmadd(RealV p_a, RealV p_b, RealV p_c) { return { vmlaq_f32(p_c.v, p_a.v, p_b.v) }; }
+	// Conversion truncates, add 0.5 with the sign of p_a first.
+	_ALWAYS_INLINE_ friend RealV round(RealV p_a) {
+		float32x4_t half = vbslq_f32(vdupq_n_u32(0x80000000), p_a.v, vdupq_n_f32(0.5f));
+		return { vcvtq_f32_s32(vcvtq_s32_f32(vaddq_f32(p_a.v, half))) };
+	}
+#endif
+
+	_ALWAYS_INLINE_ friend RealV min(RealV p_a, RealV p_b) { return { vminq_f32(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV max(RealV p_a, RealV p_b) { return { vmaxq_f32(p_a.v, p_b.v) }; }
+
+	_ALWAYS_INLINE_ friend RealV cmp_lt(RealV p_a, RealV p_b) { return { vreinterpretq_f32_u32(vcltq_f32(p_a.v, p_b.v)) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_le(RealV p_a, RealV p_b) { return { vreinterpretq_f32_u32(vcleq_f32(p_a.v, p_b.v)) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_gt(RealV p_a, RealV p_b) { return { vreinterpretq_f32_u32(vcgtq_f32(p_a.v, p_b.v)) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_ge(RealV p_a, RealV p_b) { return { vreinterpretq_f32_u32(vcgeq_f32(p_a.v, p_b.v)) }; }
+	_ALWAYS_INLINE_ RealV operator&(RealV p_other) const { return { vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(v), vreinterpretq_u32_f32(p_other.v))) }; }
+	_ALWAYS_INLINE_ RealV operator|(RealV p_other) const { return { vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(v), vreinterpretq_u32_f32(p_other.v))) }; }
+	_ALWAYS_INLINE_ friend uint32_t mask_bits(RealV p_mask) {
+		uint32x4_t m = vshrq_n_u32(vreinterpretq_u32_f32(p_mask.v), 31);
+		return vgetq_lane_u32(m, 0) | (vgetq_lane_u32(m, 1) << 1) | (vgetq_lane_u32(m, 2) << 2) | (vgetq_lane_u32(m, 3) << 3);
+	}
+	_ALWAYS_INLINE_ friend RealV select(RealV p_mask, RealV p_a, RealV p_b) { return { vbslq_f32(vreinterpretq_u32_f32(p_mask.v), p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV pow2i(RealV p_n) { return { vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vcvtq_s32_f32(p_n.v), vdupq_n_s32(127)), 23)) }; }
+
+	static constexpr int RSQRT_ESTIMATE_BITS = 8;
+	_ALWAYS_INLINE_ friend RealV rsqrt_estimate(RealV p_a) { return { vrsqrteq_f32(p_a.v) }; }
+};
+
+#elif defined(GODOT_SIMD_NEON) && !defined(GODOT_SIMD_REAL_SCALAR)
+
+struct RealV {
+	static constexpr int WIDTH = 2;
+	float64x2_t v;
+
+	_ALWAYS_INLINE_ static RealV splat(real_t p_value) { return { vdupq_n_f64(p_value) }; }
+	_ALWAYS_INLINE_ static RealV load(const real_t *p_src) { return { vld1q_f64(p_src) }; }
+	_ALWAYS_INLINE_ void store(real_t *p_dst) const { vst1q_f64(p_dst, v); }
+
+	_ALWAYS_INLINE_ RealV operator+(RealV p_other) const { return { vaddq_f64(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator-(RealV p_other) const { return { vsubq_f64(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator*(RealV p_other) const { return { vmulq_f64(v, p_other.v) }; }
+	_ALWAYS_INLINE_ RealV operator/(RealV p_other) const { return { vdivq_f64(v, p_other.v) }; }
+
+	_ALWAYS_INLINE_ friend RealV min(RealV p_a, RealV p_b) { return { vminq_f64(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV max(RealV p_a, RealV p_b) { return { vmaxq_f64(p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV sqrt(RealV p_a) { return { vsqrtq_f64(p_a.v) }; }
+	_ALWAYS_INLINE_ friend RealV fmadd(RealV p_a, RealV p_b, RealV p_c) { return { vfmaq_f64(p_c.v, p_a.v, p_b.v) }; }
+
+	_ALWAYS_INLINE_ friend RealV cmp_lt(RealV p_a, RealV p_b) { return { vreinterpretq_f64_u64(vcltq_f64(p_a.v, p_b.v)) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_le(RealV p_a, RealV p_b) { return { vreinterpretq_f64_u64(vcleq_f64(p_a.v, p_b.v)) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_gt(RealV p_a, RealV p_b) { return { vreinterpretq_f64_u64(vcgtq_f64(p_a.v, p_b.v)) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_ge(RealV p_a, RealV p_b) { return { vreinterpretq_f64_u64(vcgeq_f64(p_a.v, p_b.v)) }; }
+	_ALWAYS_INLINE_ RealV operator&(RealV p_other) const { return { vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(v), vreinterpretq_u64_f64(p_other.v))) }; }
+	_ALWAYS_INLINE_ RealV operator|(RealV p_other) const { return { vreinterpretq_f64_u64(vorrq_u64(vreinterpretq_u64_f64(v), vreinterpretq_u64_f64(p_other.v))) }; }
+	_ALWAYS_INLINE_ friend uint32_t mask_bits(RealV p_mask) {
+		uint64x2_t m = vshrq_n_u64(vreinterpretq_u64_f64(p_mask.v), 63);
+		return uint32_t(vgetq_lane_u64(m, 0) | (vgetq_lane_u64(m, 1) << 1));
+	}
+	_ALWAYS_INLINE_ friend RealV select(RealV p_mask, RealV p_a, RealV p_b) { return { vbslq_f64(vreinterpretq_u64_f64(p_mask.v), p_a.v, p_b.v) }; }
+	_ALWAYS_INLINE_ friend RealV round(RealV p_a) { return { vrndnq_f64(p_a.v) }; }
+	_ALWAYS_INLINE_ friend RealV pow2i(RealV p_n) { return { vreinterpretq_f64_s64(vshlq_n_s64(vaddq_s64(vcvtq_s64_f64(p_n.v), vdupq_n_s64(1023)), 52)) }; }
+
+	static constexpr int RSQRT_ESTIMATE_BITS = 8;
+	_ALWAYS_INLINE_ friend RealV rsqrt_estimate(RealV p_a) { return { vrsqrteq_f64(p_a.v) }; }
+};
+
+#else
+
+struct RealV {
+	static constexpr int WIDTH = 1;
+	real_t v;
+
+#ifdef REAL_T_IS_DOUBLE
+	using MaskInt = uint64_t;
+#else
+	using MaskInt = uint32_t;
+#endif
+
+	_ALWAYS_INLINE_ static RealV splat(real_t p_value) { return { p_value }; }
+	_ALWAYS_INLINE_ static RealV load(const real_t *p_src) { return { *p_src }; }
+	_ALWAYS_INLINE_ void store(real_t *p_dst) const { *p_dst = v; }
+
+	_ALWAYS_INLINE_ RealV operator+(RealV p_other) const { return { v + p_other.v }; }
+	_ALWAYS_INLINE_ RealV operator-(RealV p_other) const { return { v - p_other.v }; }
+	_ALWAYS_INLINE_ RealV operator*(RealV p_other) const { return { v * p_other.v }; }
+	_ALWAYS_INLINE_ RealV operator/(RealV p_other) const { return { v / p_other.v }; }
+
+	_ALWAYS_INLINE_ friend RealV min(RealV p_a, RealV p_b) { return { p_a.v < p_b.v ? p_a.v : p_b.v }; }
+	_ALWAYS_INLINE_ friend RealV max(RealV p_a, RealV p_b) { return { p_a.v > p_b.v ? p_a.v : p_b.v }; }
+	_ALWAYS_INLINE_ friend RealV sqrt(RealV p_a) { return { std::sqrt(p_a.v) }; }
+	_ALWAYS_INLINE_ friend RealV fmadd(RealV p_a, RealV p_b, RealV p_c) { return { p_a.v * p_b.v + p_c.v }; }
+
+	// Masks keep the all-ones / all-zeros bit patterns of the vector backends.
+	_ALWAYS_INLINE_ static RealV _mask(bool p_set) { return { std::bit_cast<real_t>(p_set ? ~MaskInt(0) : MaskInt(0)) }; }
+	_ALWAYS_INLINE_ friend RealV cmp_lt(RealV p_a, RealV p_b) { return _mask(p_a.v < p_b.v); }
+	_ALWAYS_INLINE_ friend RealV cmp_le(RealV p_a, RealV p_b) { return _mask(p_a.v <= p_b.v); }
+	_ALWAYS_INLINE_ friend RealV cmp_gt(RealV p_a, RealV p_b) { return _mask(p_a.v > p_b.v); }
+	_ALWAYS_INLINE_ friend RealV cmp_ge(RealV p_a, RealV p_b) { return _mask(p_a.v >= p_b.v); }
+	_ALWAYS_INLINE_ RealV operator&(RealV p_other) const { return { std::bit_cast<real_t>(std::bit_cast<MaskInt>(v) & std::bit_cast<MaskInt>(p_other.v)) }; }
+	_ALWAYS_INLINE_ RealV operator|(RealV p_other) const { return { std::bit_cast<real_t>(std::bit_cast<MaskInt>(v) | std::bit_cast<MaskInt>(p_other.v)) }; }
+	_ALWAYS_INLINE_ friend uint32_t mask_bits(RealV p_mask) { return uint32_t(std::bit_cast<MaskInt>(p_mask.v) >> (sizeof(MaskInt) * 8 - 1)); }
+
+	_ALWAYS_INLINE_ friend RealV select(RealV p_mask, RealV p_a, RealV p_b) { return std::bit_cast<MaskInt>(p_mask.v) ? p_a : p_b; }
+	_ALWAYS_INLINE_ friend RealV round(RealV p_a) { return { std::rint(p_a.v) }; }
+#ifdef REAL_T_IS_DOUBLE
+	_ALWAYS_INLINE_ friend RealV pow2i(RealV p_n) { return { std::bit_cast<real_t>(MaskInt(int64_t(p_n.v) + 1023) << 52) }; }
+#else
+	_ALWAYS_INLINE_ friend RealV pow2i(RealV p_n) { return { std::bit_cast<real_t>(MaskInt(int32_t(p_n.v) + 127) << 23) }; }
+#endif
+
+	// Plain division, there is nothing to refine.
+	static constexpr int RSQRT_ESTIMATE_BITS = std::numeric_limits<real_t>::digits;
+	_ALWAYS_INLINE_ friend RealV rsqrt_estimate(RealV p_a) { return { real_t(1) / std::sqrt(p_a.v) }; }
+};
+
+#endif
+
+// SSE helpers for load2()/load3()/load4() and the stores, also used to build the AVX2 versions from two halves.
+#if defined(GODOT_SIMD_SSE2) || defined(GODOT_SIMD_AVX2)
+
+// x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3 -> x0 x1 x2 x3 | y0 y1 y2 y3 | z0 z1 z2 z3
+_ALWAYS_INLINE_ void _deinterleave3_ps(const float *p_src, __m128 &r_x, __m128 &r_y, __m128 &r_z) {
+	__m128 a = _mm_loadu_ps(p_src);
+	__m128 b = _mm_loadu_ps(p_src + 4);
+	__m128 c = _mm_loadu_ps(p_src + 8);
+	__m128 x2y2x3y3 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 1, 3, 2));
+	__m128 y0z0y1z1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 0, 2, 1));
+	r_x = _mm_shuffle_ps(a, x2y2x3y3, _MM_SHUFFLE(2, 0, 3, 0));
+	r_y = _mm_shuffle_ps(y0z0y1z1, x2y2x3y3, _MM_SHUFFLE(3, 1, 2, 0));
+	r_z = _mm_shuffle_ps(y0z0y1z1, c, _MM_SHUFFLE(3, 0, 3, 1));
+}
+
+_ALWAYS_INLINE_ void _interleave3_ps(float *p_dst, __m128 p_x, __m128 p_y, __m128 p_z) {
+	__m128 x0y0x1y1 = _mm_unpacklo_ps(p_x, p_y);
+	__m128 x2y2x3y3 = _mm_unpackhi_ps(p_x, p_y);
+	__m128 z0z1x1y1 = _mm_shuffle_ps(p_z, x0y0x1y1, _MM_SHUFFLE(3, 2, 1, 0));
+	__m128 z2z3x3y3 = _mm_shuffle_ps(p_z, x2y2x3y3, _MM_SHUFFLE(3, 2, 3, 2));
+	_mm_storeu_ps(p_dst, _mm_shuffle_ps(x0y0x1y1, z0z1x1y1, _MM_SHUFFLE(2, 0, 1, 0)));
+	_mm_storeu_ps(p_dst + 4, _mm_shuffle_ps(z0z1x1y1, x2y2x3y3, _MM_SHUFFLE(1, 0, 1, 3)));
+	_mm_storeu_ps(p_dst + 8, _mm_shuffle_ps(z2z3x3y3, z2z3x3y3, _MM_SHUFFLE(1, 3, 2, 0)));
+}
+
+// x0 y0 | z0 x1 | y1 z1 -> x0 x1 | y0 y1 | z0 z1
+_ALWAYS_INLINE_ void _deinterleave3_pd(const double *p_src, __m128d &r_x, __m128d &r_y, __m128d &r_z) {
+	__m128d a = _mm_loadu_pd(p_src);
+	__m128d b = _mm_loadu_pd(p_src + 2);
+	__m128d c = _mm_loadu_pd(p_src + 4);
+	r_x = _mm_shuffle_pd(a, b, 2);
+	r_y = _mm_shuffle_pd(a, c, 1);
+	r_z = _mm_shuffle_pd(b, c, 2);
+}
+
+_ALWAYS_INLINE_ void _interleave3_pd(double *p_dst, __m128d p_x, __m128d p_y, __m128d p_z) {
+	_mm_storeu_pd(p_dst, _mm_shuffle_pd(p_x, p_y, 0));
+	_mm_storeu_pd(p_dst + 2, _mm_shuffle_pd(p_z, p_x, 2));
+	_mm_storeu_pd(p_dst + 4, _mm_shuffle_pd(p_y, p_z, 3));
+}
+
+// x0 y0 x1 y1 | x2 y2 x3 y3 -> x0 x1 x2 x3 | y0 y1 y2 y3
+_ALWAYS_INLINE_ void _deinterleave2_ps(const float *p_src, __m128 &r_x, __m128 &r_y) {
+	__m128 a = _mm_loadu_ps(p_src);
+	__m128 b = _mm_loadu_ps(p_src + 4);
+	r_x = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+	r_y = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+_ALWAYS_INLINE_ void _interleave2_ps(float *p_dst, __m128 p_x, __m128 p_y) {
+	_mm_storeu_ps(p_dst, _mm_unpacklo_ps(p_x, p_y));
+	_mm_storeu_ps(p_dst + 4, _mm_unpackhi_ps(p_x, p_y));
+}
+
+// x0 y0 | x1 y1 -> x0 x1 | y0 y1
+_ALWAYS_INLINE_ void _deinterleave2_pd(const double *p_src, __m128d &r_x, __m128d &r_y) {
+	__m128d a = _mm_loadu_pd(p_src);
+	__m128d b = _mm_loadu_pd(p_src + 2);
+	r_x = _mm_unpacklo_pd(a, b);
+	r_y = _mm_unpackhi_pd(a, b);
+}
+
+_ALWAYS_INLINE_ void _interleave2_pd(double *p_dst, __m128d p_x, __m128d p_y) {
+	_mm_storeu_pd(p_dst, _mm_unpacklo_pd(p_x, p_y));
+	_mm_storeu_pd(p_dst + 2, _mm_unpackhi_pd(p_x, p_y));
+}
+
+// Four x y z w rows -> one register per component.
+_ALWAYS_INLINE_ void _deinterleave4_ps(const float *p_src, __m128 &r_x, __m128 &r_y, __m128 &r_z, __m128 &r_w) {
+	r_x = _mm_loadu_ps(p_src);
+	r_y = _mm_loadu_ps(p_src + 4);
+	r_z = _mm_loadu_ps(p_src + 8);
+	r_w = _mm_loadu_ps(p_src + 12);
+	_MM_TRANSPOSE4_PS(r_x, r_y, r_z, r_w);
+}
+
+_ALWAYS_INLINE_ void _interleave4_ps(float *p_dst, __m128 p_x, __m128 p_y, __m128 p_z, __m128 p_w) {
+	_MM_TRANSPOSE4_PS(p_x, p_y, p_z, p_w);
+	_mm_storeu_ps(p_dst, p_x);
+	_mm_storeu_ps(p_dst + 4, p_y);
+	_mm_storeu_ps(p_dst + 8, p_z);
+	_mm_storeu_ps(p_dst + 12, p_w);
+}
+
+// x0 y0 | z0 w0 | x1 y1 | z1 w1 -> x0 x1 | y0 y1 | z0 z1 | w0 w1
+_ALWAYS_INLINE_ void _deinterleave4_pd(const double *p_src, __m128d &r_x, __m128d &r_y, __m128d &r_z, __m128d &r_w) {
+	__m128d xy0 = _mm_loadu_pd(p_src);
+	__m128d zw0 = _mm_loadu_pd(p_src + 2);
+	__m128d xy1 = _mm_loadu_pd(p_src + 4);
+	__m128d zw1 = _mm_loadu_pd(p_src + 6);
+	r_x = _mm_unpacklo_pd(xy0, xy1);
+	r_y = _mm_unpackhi_pd(xy0, xy1);
+	r_z = _mm_unpacklo_pd(zw0, zw1);
+	r_w = _mm_unpackhi_pd(zw0, zw1);
+}
+
+_ALWAYS_INLINE_ void _interleave4_pd(double *p_dst, __m128d p_x, __m128d p_y, __m128d p_z, __m128d p_w) {
+	_mm_storeu_pd(p_dst, _mm_unpacklo_pd(p_x, p_y));
+	_mm_storeu_pd(p_dst + 2, _mm_unpacklo_pd(p_z, p_w));
+	_mm_storeu_pd(p_dst + 4, _mm_unpackhi_pd(p_x, p_y));
+	_mm_storeu_pd(p_dst + 6, _mm_unpackhi_pd(p_z, p_w));
+}
+
+#endif
+
+_ALWAYS_INLINE_ void load3(const real_t *p_src, RealV &r_x, RealV &r_y, RealV &r_z) {
+#if defined(GODOT_SIMD_AVX2) && !defined(REAL_T_IS_DOUBLE)
+	__m128 x0, y0, z0, x1, y1, z1;
+	_deinterleave3_ps(p_src, x0, y0, z0);
+	_deinterleave3_ps(p_src + 12, x1, y1, z1);
+	r_x.v = _mm256_set_m128(x1, x0);
+	r_y.v = _mm256_set_m128(y1, y0);
+	r_z.v = _mm256_set_m128(z1, z0);
+#elif defined(GODOT_SIMD_AVX2)
+	__m128d x0, y0, z0, x1, y1, z1;
+	_deinterleave3_pd(p_src, x0, y0, z0);
+	_deinterleave3_pd(p_src + 6, x1, y1, z1);
+	r_x.v = _mm256_set_m128d(x1, x0);
+	r_y.v = _mm256_set_m128d(y1, y0);
+	r_z.v = _mm256_set_m128d(z1, z0);
+#elif defined(GODOT_SIMD_SSE2) && !defined(REAL_T_IS_DOUBLE)
+	_deinterleave3_ps(p_src, r_x.v, r_y.v, r_z.v);
+#elif defined(GODOT_SIMD_SSE2)
+	_deinterleave3_pd(p_src, r_x.v, r_y.v, r_z.v);
+#elif defined(GODOT_SIMD_NEON) && !defined(REAL_T_IS_DOUBLE)
+	float32x4x3_t xyz = vld3q_f32(p_src);
+	r_x.v = xyz.val[0];
+	r_y.v = xyz.val[1];
+	r_z.v = xyz.val[2];
+#elif defined(GODOT_SIMD_NEON) && !defined(GODOT_SIMD_REAL_SCALAR)
+	float64x2x3_t xyz = vld3q_f64(p_src);
+	r_x.v = xyz.val[0];
+	r_y.v = xyz.val[1];
+	r_z.v = xyz.val[2];
+#else
+	r_x.v = p_src[0];
+	r_y.v = p_src[1];
+	r_z.v = p_src[2];
+#endif
+}
+
+_ALWAYS_INLINE_ void store3(real_t *p_dst, RealV p_x, RealV p_y, RealV p_z) {
+#if defined(GODOT_SIMD_AVX2) && !defined(REAL_T_IS_DOUBLE)
+	_interleave3_ps(p_dst, _mm256_castps256_ps128(p_x.v), _mm256_castps256_ps128(p_y.v), _mm256_castps256_ps128(p_z.v));
+	_interleave3_ps(p_dst + 12, _mm256_extractf128_ps(p_x.v, 1), _mm256_extractf128_ps(p_y.v, 1), _mm256_extractf128_ps(p_z.v, 1));
+#elif defined(GODOT_SIMD_AVX2)
+	_interleave3_pd(p_dst, _mm256_castpd256_pd128(p_x.v), _mm256_castpd256_pd128(p_y.v), _mm256_castpd256_pd128(p_z.v));
+	_interleave3_pd(p_dst + 6, _mm256_extractf128_pd(p_x.v, 1), _mm256_extractf128_pd(p_y.v, 1), _mm256_extractf128_pd(p_z.v, 1));
+#elif defined(GODOT_SIMD_SSE2) && !defined(REAL_T_IS_DOUBLE)
+	_interleave3_ps(p_dst, p_x.v, p_y.v, p_z.v);
+#elif defined(GODOT_SIMD_SSE2)
+	_interleave3_pd(p_dst, p_x.v, p_y.v, p_z.v);
+#elif defined(GODOT_SIMD_NEON) && !defined(REAL_T_IS_DOUBLE)
+	float32x4x3_t xyz = { { p_x.v, p_y.v, p_z.v } };
+	vst3q_f32(p_dst, xyz);
+#elif defined(GODOT_SIMD_NEON) && !defined(GODOT_SIMD_REAL_SCALAR)
+	float64x2x3_t xyz = { { p_x.v, p_y.v, p_z.v } };
+	vst3q_f64(p_dst, xyz);
+#else
+	p_dst[0] = p_x.v;
+	p_dst[1] = p_y.v;
+	p_dst[2] = p_z.v;
+#endif
+}
+
+_ALWAYS_INLINE_ void load2(const real_t *p_src, RealV &r_x, RealV &r_y) {
+#if defined(GODOT_SIMD_AVX2) && !defined(REAL_T_IS_DOUBLE)
+	__m128 x0, y0, x1, y1;
+	_deinterleave2_ps(p_src, x0, y0);
+	_deinterleave2_ps(p_src + 8, x1, y1);
+	r_x.v = _mm256_set_m128(x1, x0);
+	r_y.v = _mm256_set_m128(y1, y0);
+#elif defined(GODOT_SIMD_AVX2)
+	__m128d x0, y0, x1, y1;
+	_deinterleave2_pd(p_src, x0, y0);
+	_deinterleave2_pd(p_src + 4, x1, y1);
+	r_x.v = _mm256_set_m128d(x1, x0);
+	r_y.v = _mm256_set_m128d(y1, y0);
+#elif defined(GODOT_SIMD_SSE2) && !defined(REAL_T_IS_DOUBLE)
+	_deinterleave2_ps(p_src, r_x.v, r_y.v);
+#elif defined(GODOT_SIMD_SSE2)
+	_deinterleave2_pd(p_src, r_x.v, r_y.v);
+#elif defined(GODOT_SIMD_NEON) && !defined(REAL_T_IS_DOUBLE)
+	float32x4x2_t xy = vld2q_f32(p_src);
+	r_x.v = xy.val[0];
+	r_y.v = xy.val[1];
+#elif defined(GODOT_SIMD_NEON) && !defined(GODOT_SIMD_REAL_SCALAR)
+	float64x2x2_t xy = vld2q_f64(p_src);
+	r_x.v = xy.val[0];
+	r_y.v = xy.val[1];
+#else
+	r_x.v = p_src[0];
+	r_y.v = p_src[1];
+#endif
+}
+
+_ALWAYS_INLINE_ void store2(real_t *p_dst, RealV p_x, RealV p_y) {
+#if defined(GODOT_SIMD_AVX2) && !defined(REAL_T_IS_DOUBLE)
+	_interleave2_ps(p_dst, _mm256_castps256_ps128(p_x.v), _mm256_castps256_ps128(p_y.v));
+	_interleave2_ps(p_dst + 8, _mm256_extractf128_ps(p_x.v, 1), _mm256_extractf128_ps(p_y.v, 1));
+#elif defined(GODOT_SIMD_AVX2)
+	_interleave2_pd(p_dst, _mm256_castpd256_pd128(p_x.v), _mm256_castpd256_pd128(p_y.v));
+	_interleave2_pd(p_dst + 4, _mm256_extractf128_pd(p_x.v, 1), _mm256_extractf128_pd(p_y.v, 1));
+#elif defined(GODOT_SIMD_SSE2) && !defined(REAL_T_IS_DOUBLE)
+	_interleave2_ps(p_dst, p_x.v, p_y.v);
+#elif defined(GODOT_SIMD_SSE2)
+	_interleave2_pd(p_dst, p_x.v, p_y.v);
+#elif defined(GODOT_SIMD_NEON) && !defined(REAL_T_IS_DOUBLE)
+	float32x4x2_t xy = { { p_x.v, p_y.v } };
+	vst2q_f32(p_dst, xy);
+#elif defined(GODOT_SIMD_NEON) && !defined(GODOT_SIMD_REAL_SCALAR)
+	float64x2x2_t xy = { { p_x.v, p_y.v } };
+	vst2q_f64(p_dst, xy);
+#else
+	p_dst[0] = p_x.v;
+	p_dst[1] = p_y.v;
+#endif
+}
+
+_ALWAYS_INLINE_ void load4(const real_t *p_src, RealV &r_x, RealV &r_y, RealV &r_z, RealV &r_w) {
+#if defined(GODOT_SIMD_AVX2) && !defined(REAL_T_IS_DOUBLE)
+	__m128 x0, y0, z0, w0, x1, y1, z1, w1;
+	_deinterleave4_ps(p_src, x0, y0, z0, w0);
+	_deinterleave4_ps(p_src + 16, x1, y1, z1, w1);
+	r_x.v = _mm256_set_m128(x1, x0);
+	r_y.v = _mm256_set_m128(y1, y0);
+	r_z.v = _mm256_set_m128(z1, z0);
+	r_w.v = _mm256_set_m128(w1, w0);
+#elif defined(GODOT_SIMD_AVX2)
+	__m128d x0, y0, z0, w0, x1, y1, z1, w1;
+	_deinterleave4_pd(p_src, x0, y0, z0, w0);
+	_deinterleave4_pd(p_src + 8, x1, y1, z1, w1);
+	r_x.v = _mm256_set_m128d(x1, x0);
+	r_y.v = _mm256_set_m128d(y1, y0);
+	r_z.v = _mm256_set_m128d(z1, z0);
+	r_w.v = _mm256_set_m128d(w1, w0);
+#elif defined(GODOT_SIMD_SSE2) && !defined(REAL_T_IS_DOUBLE)
+	_deinterleave4_ps(p_src, r_x.v, r_y.v, r_z.v, r_w.v);
+#elif defined(GODOT_SIMD_SSE2)
+	_deinterleave4_pd(p_src, r_x.v, r_y.v, r_z.v, r_w.v);
+#elif defined(GODOT_SIMD_NEON) && !defined(REAL_T_IS_DOUBLE)
+	float32x4x4_t xyzw = vld4q_f32(p_src);
+	r_x.v = xyzw.val[0];
+	r_y.v = xyzw.val[1];
+	r_z.v = xyzw.val[2];
+	r_w.v = xyzw.val[3];
+#elif defined(GODOT_SIMD_NEON) && !defined(GODOT_SIMD_REAL_SCALAR)
+	float64x2x4_t xyzw = vld4q_f64(p_src);
+	r_x.v = xyzw.val[0];
+	r_y.v = xyzw.val[1];
+	r_z.v = xyzw.val[2];
+	r_w.v = xyzw.val[3];
+#else
+	r_x.v = p_src[0];
+	r_y.v = p_src[1];
+	r_z.v = p_src[2];
+	r_w.v = p_src[3];
+#endif
+}
+
+_ALWAYS_INLINE_ void store4(real_t *p_dst, RealV p_x, RealV p_y, RealV p_z, RealV p_w) {
+#if defined(GODOT_SIMD_AVX2) && !defined(REAL_T_IS_DOUBLE)
+	_interleave4_ps(p_dst, _mm256_castps256_ps128(p_x.v), _mm256_castps256_ps128(p_y.v), _mm256_castps256_ps128(p_z.v), _mm256_castps256_ps128(p_w.v));
+	_interleave4_ps(p_dst + 16, _mm256_extractf128_ps(p_x.v, 1), _mm256_extractf128_ps(p_y.v, 1), _mm256_extractf128_ps(p_z.v, 1), _mm256_extractf128_ps(p_w.v, 1));
+#elif defined(GODOT_SIMD_AVX2)
+	_interleave4_pd(p_dst, _mm256_castpd256_pd128(p_x.v), _mm256_castpd256_pd128(p_y.v), _mm256_castpd256_pd128(p_z.v), _mm256_castpd256_pd128(p_w.v));
+	_interleave4_pd(p_dst + 8, _mm256_extractf128_pd(p_x.v, 1), _mm256_extractf128_pd(p_y.v, 1), _mm256_extractf128_pd(p_z.v, 1), _mm256_extractf128_pd(p_w.v, 1));
+#elif defined(GODOT_SIMD_SSE2) && !defined(REAL_T_IS_DOUBLE)
+	_interleave4_ps(p_dst, p_x.v, p_y.v, p_z.v, p_w.v);
+#elif defined(GODOT_SIMD_SSE2)
+	_interleave4_pd(p_dst, p_x.v, p_y.v, p_z.v, p_w.v);
+#elif defined(GODOT_SIMD_NEON) && !defined(REAL_T_IS_DOUBLE)
+	float32x4x4_t xyzw = { { p_x.v, p_y.v, p_z.v, p_w.v } };
+	vst4q_f32(p_dst, xyzw);
+#elif defined(GODOT_SIMD_NEON) && !defined(GODOT_SIMD_REAL_SCALAR)
+	float64x2x4_t xyzw = { { p_x.v, p_y.v, p_z.v, p_w.v } };
+	vst4q_f64(p_dst, xyzw);
+#else
+	p_dst[0] = p_x.v;
+	p_dst[1] = p_y.v;
+	p_dst[2] = p_z.v;
+	p_dst[3] = p_w.v;
+#endif
+}
+
+// A mask with every lane set or cleared.
+_ALWAYS_INLINE_ RealV mask_splat(bool p_set) {
+	return p_set ? cmp_le(RealV::splat(0), RealV::splat(0)) : cmp_lt(RealV::splat(0), RealV::splat(0));
+}
+
+// Horizontal reductions, meant for the end of a kernel rather than its inner loop.
+_ALWAYS_INLINE_ real_t reduce_min(RealV p_value) {
+	real_t lanes[RealV::WIDTH];
+	p_value.store(lanes);
+	real_t ret = lanes[0];
+	for (int i = 1; i < RealV::WIDTH; i++) {
+		ret = lanes[i] < ret ? lanes[i] : ret;
+	}
+	return ret;
+}
+
+_ALWAYS_INLINE_ real_t reduce_max(RealV p_value) {
+	real_t lanes[RealV::WIDTH];
+	p_value.store(lanes);
+	real_t ret = lanes[0];
+	for (int i = 1; i < RealV::WIDTH; i++) {
+		ret = lanes[i] > ret ? lanes[i] : ret;
+	}
+	return ret;
+}
+
+} // namespace simd
+
+} // namespace godot
+
+#endif // GODOT_SIMD_HPP
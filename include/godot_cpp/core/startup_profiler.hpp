@@ -0,0 +1,97 @@
+/**************************************************************************/
+/*  startup_profiler.hpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_STARTUP_PROFILER_HPP
+#define GODOT_STARTUP_PROFILER_HPP
+
+#ifdef STARTUP_PROFILING_ENABLED
+
+#include <godot_cpp/core/defs.hpp>
+
+#include <gdextension_interface.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace godot {
+
+class StringName;
+
+namespace internal {
+
+// Records how long the extension spends in each phase of its initialization, and reports it as one
+// line of JSON at the end of each initialization level. Only used during (single threaded) loading.
+class StartupProfiler {
+public:
+	static void add_phase(const char *p_phase, uint64_t p_usec);
+	static void add_class(const StringName &p_class, uint64_t p_usec, uint32_t p_method_count);
+	static void report(GDExtensionInitializationLevel p_level);
+};
+
+class StartupProfileScope {
+	const char *phase = nullptr;
+	std::chrono::steady_clock::time_point start;
+
+public:
+	_FORCE_INLINE_ uint64_t get_elapsed_usec() const {
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// Records the phase now instead of when going out of scope.
+	void stop() {
+		if (phase) {
+			StartupProfiler::add_phase(phase, get_elapsed_usec());
+			phase = nullptr;
+		}
+	}
+
+	explicit StartupProfileScope(const char *p_phase) :
+			phase(p_phase), start(std::chrono::steady_clock::now()) {}
+	~StartupProfileScope() { stop(); }
+
+	StartupProfileScope(const StartupProfileScope &) = delete;
+	StartupProfileScope &operator=(const StartupProfileScope &) = delete;
+};
+
+} // namespace internal
+
+} // namespace godot
+
+#define STARTUP_PROFILE_BEGIN(m_phase) ::godot::internal::StartupProfileScope _startup_profile_##m_phase(#m_phase)
+#define STARTUP_PROFILE_END(m_phase) _startup_profile_##m_phase.stop()
+
+#else
+
+#define STARTUP_PROFILE_BEGIN(m_phase)
+#define STARTUP_PROFILE_END(m_phase)
+
+#endif // STARTUP_PROFILING_ENABLED
+
+#endif // GODOT_STARTUP_PROFILER_HPP
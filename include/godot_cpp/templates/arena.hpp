@@ -0,0 +1,256 @@
+/**************************************************************************/
+/*  arena.hpp                                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_ARENA_HPP
+#define GODOT_ARENA_HPP
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/math.hpp>
+#include <godot_cpp/core/memory.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace godot {
+
+/**
+ * Bump allocator for short-lived temporaries.
+ *
+ * Memory is carved out of blocks obtained from the engine allocator. Freeing
+ * individual allocations is a no-op; everything allocated after a mark is
+ * released at once with reset_to(), or all of it with reset(). Released blocks
+ * are kept for reuse, so once an arena has grown to its working size it stops
+ * calling into the engine entirely.
+ *
+ * An Arena is not thread safe. Use FrameArena to get one per thread.
+ */
+
+class Arena {
+	struct Block {
+		Block *prev = nullptr;
+		size_t capacity = 0;
+		size_t used = 0;
+
+		_FORCE_INLINE_ uint8_t *data() { return reinterpret_cast<uint8_t *>(this) + HEADER_SIZE; }
+	};
+
+	static constexpr size_t HEADER_SIZE = (sizeof(Block) + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+
+	Block *current = nullptr; // Blocks in use, newest first.
+	Block *spare = nullptr; // Blocks released by a reset, kept for reuse.
+	size_t block_size = 0;
+	size_t used_bytes = 0;
+	size_t reserved_bytes = 0;
+
+	Block *_take_block(size_t p_min_capacity) {
+		// Reuse a spare block if one is large enough.
+		Block **prev_link = &spare;
+		for (Block *b = spare; b; b = b->prev) {
+			if (b->capacity >= p_min_capacity) {
+				*prev_link = b->prev;
+				b->used = 0;
+				return b;
+			}
+			prev_link = &b->prev;
+		}
+
+		size_t capacity = MAX(block_size, p_min_capacity);
+		Block *b = reinterpret_cast<Block *>(Memory::alloc_static(HEADER_SIZE + capacity));
+		ERR_FAIL_NULL_V(b, nullptr);
+		b->prev = nullptr;
+		b->capacity = capacity;
+		b->used = 0;
+		reserved_bytes += capacity;
+		return b;
+	}
+
+	static void _free_chain(Block *p_block) {
+		while (p_block) {
+			Block *prev = p_block->prev;
+			Memory::free_static(p_block);
+			p_block = prev;
+		}
+	}
+
+public:
+	static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+	struct Mark {
+		void *block = nullptr;
+		size_t used = 0;
+		size_t used_bytes = 0;
+	};
+
+	void *alloc(size_t p_bytes, size_t p_align = alignof(std::max_align_t)) {
+		ERR_FAIL_COND_V((p_align & (p_align - 1)) != 0, nullptr);
+
+		if (current) {
+			uintptr_t base = reinterpret_cast<uintptr_t>(current->data());
+			uintptr_t ptr = (base + current->used + p_align - 1) & ~uintptr_t(p_align - 1);
+			size_t end = (ptr - base) + p_bytes;
+			if (end <= current->capacity) {
+				used_bytes += end - current->used;
+				current->used = end;
+				return reinterpret_cast<void *>(ptr);
+			}
+		}
+
+		// Block data is max_align_t aligned, only larger alignments need padding.
+		size_t padding = p_align > alignof(std::max_align_t) ? p_align : 0;
+		Block *b = _take_block(p_bytes + padding);
+		ERR_FAIL_NULL_V(b, nullptr);
+		b->prev = current;
+		current = b;
+
+		uintptr_t base = reinterpret_cast<uintptr_t>(b->data());
+		uintptr_t ptr = (base + p_align - 1) & ~uintptr_t(p_align - 1);
+		b->used = (ptr - base) + p_bytes;
+		used_bytes += b->used;
+		return reinterpret_cast<void *>(ptr);
+	}
+
+	template <typename T>
+	_FORCE_INLINE_ T *alloc_array(size_t p_count) {
+		return static_cast<T *>(alloc(sizeof(T) * p_count, alignof(T)));
+	}
+
+	_FORCE_INLINE_ Mark get_mark() const {
+		Mark m;
+		m.block = current;
+		m.used = current ? current->used : 0;
+		m.used_bytes = used_bytes;
+		return m;
+	}
+
+	// Releases everything allocated since the mark was taken.
+	void reset_to(const Mark &p_mark) {
+		while (current && current != p_mark.block) {
+			Block *b = current;
+			current = b->prev;
+			b->prev = spare;
+			spare = b;
+		}
+		ERR_FAIL_COND_MSG(current != p_mark.block, "Arena mark does not belong to this arena or was already released.");
+		if (current) {
+			current->used = p_mark.used;
+		}
+		used_bytes = p_mark.used_bytes;
+	}
+
+	void reset() {
+		reset_to(Mark());
+	}
+
+	// Returns all blocks, including spare ones, to the engine.
+	void free_memory() {
+		_free_chain(current);
+		_free_chain(spare);
+		current = nullptr;
+		spare = nullptr;
+		used_bytes = 0;
+		reserved_bytes = 0;
+	}
+
+	_FORCE_INLINE_ size_t get_used_bytes() const { return used_bytes; }
+	_FORCE_INLINE_ size_t get_reserved_bytes() const { return reserved_bytes; }
+
+	Arena(size_t p_block_size = DEFAULT_BLOCK_SIZE) :
+			block_size(p_block_size) {}
+
+	Arena(const Arena &) = delete;
+	Arena &operator=(const Arena &) = delete;
+
+	~Arena() {
+		free_memory();
+	}
+};
+
+/**
+ * Per-thread arena for temporaries that do not outlive the current frame.
+ *
+ * Call FrameArena::reset() once per frame (or use FrameArena::Scope for
+ * narrower lifetimes) on the thread that made the allocations. Containers can
+ * use it through FrameArenaAllocator (List, RBMap, RBSet) or
+ * FrameArenaTypedAllocator (HashMap elements); those containers must be gone
+ * before the arena is reset.
+ *
+ * The main thread's arena is freed when the core level deinitializes. Other
+ * threads must call FrameArena::free_memory() before they exit or the engine
+ * shuts down, whichever comes first, since the arena otherwise frees its
+ * blocks from the thread's exit.
+ */
+
+class FrameArena {
+	static inline thread_local Arena arena;
+
+public:
+	_FORCE_INLINE_ static Arena &get() { return arena; }
+
+	_FORCE_INLINE_ static void *alloc(size_t p_bytes, size_t p_align = alignof(std::max_align_t)) { return arena.alloc(p_bytes, p_align); }
+	_FORCE_INLINE_ static void reset() { arena.reset(); }
+	_FORCE_INLINE_ static void free_memory() { arena.free_memory(); }
+
+	// Restores the arena to its state at construction when going out of scope.
+	class Scope {
+		Arena::Mark mark;
+
+	public:
+		Scope() :
+				mark(arena.get_mark()) {}
+		~Scope() { arena.reset_to(mark); }
+
+		Scope(const Scope &) = delete;
+		Scope &operator=(const Scope &) = delete;
+	};
+};
+
+// Drop-in for DefaultAllocator, for List, RBMap and RBSet.
+class FrameArenaAllocator {
+public:
+	_ALWAYS_INLINE_ static void *alloc(size_t p_memory) { return FrameArena::alloc(p_memory); }
+	_ALWAYS_INLINE_ static void free(void *p_ptr) {}
+};
+
+// Drop-in for DefaultTypedAllocator, for HashMap elements.
+template <typename T>
+class FrameArenaTypedAllocator {
+public:
+	template <typename... Args>
+	_ALWAYS_INLINE_ T *new_allocation(const Args &&...p_args) { return memnew_placement(FrameArena::alloc(sizeof(T), alignof(T)), T(p_args...)); }
+	_ALWAYS_INLINE_ void delete_allocation(T *p_allocation) {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			p_allocation->~T();
+		}
+	}
+};
+
+} // namespace godot
+
+#endif // GODOT_ARENA_HPP
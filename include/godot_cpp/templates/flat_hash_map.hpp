@@ -0,0 +1,304 @@
+/**************************************************************************/
+/*  flat_hash_map.hpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_FLAT_HASH_MAP_HPP
+#define GODOT_FLAT_HASH_MAP_HPP
+
+#include <godot_cpp/templates/flat_hash_table.hpp>
+#include <godot_cpp/templates/pair.hpp>
+
+namespace godot {
+
+/**
+ * A HashMap variant that stores keys and values inline in an open addressing
+ * table (see FlatHashTable), instead of one heap node per element.
+ *
+ * Use it when insertion order does not matter: iteration follows slot order,
+ * and inserting or erasing may reorder it. Pointers and iterators to elements
+ * stay valid until the table is rehashed by an insertion or reserve().
+ */
+
+template <typename TKey, typename TValue>
+struct FlatHashMapGetKey {
+	static _FORCE_INLINE_ const TKey &get(const KeyValue<TKey, TValue> &p_kv) { return p_kv.key; }
+};
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class FlatHashMap {
+	typedef KeyValue<TKey, TValue> Element;
+	typedef FlatHashTable<TKey, Element, FlatHashMapGetKey<TKey, TValue>, Hasher, Comparator> Table;
+	static constexpr uint32_t INVALID_INDEX = Table::INVALID_INDEX;
+
+	Table table;
+
+	_FORCE_INLINE_ uint32_t _insert(const TKey &p_key, const TValue &p_value) {
+		if (unlikely(table.owns_address(&p_key) || table.owns_address(&p_value))) {
+			// Taken from this map (e.g. map.insert(k, map[j])), copy them before a rehash moves them.
+			TKey key = p_key;
+			TValue value = p_value;
+			return _insert_unaliased(key, value);
+		}
+		return _insert_unaliased(p_key, p_value);
+	}
+
+	_FORCE_INLINE_ uint32_t _insert_unaliased(const TKey &p_key, const TValue &p_value) {
+		bool inserted = false;
+		uint32_t index = table.prepare_insert(p_key, inserted);
+		ERR_FAIL_COND_V(index == INVALID_INDEX, INVALID_INDEX);
+		Element *kv = &table.get_slot(index);
+		if (inserted) {
+			memnew_placement(kv, Element(p_key, p_value));
+		} else {
+			kv->value = p_value;
+		}
+		return index;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return table.get_capacity(); }
+	_FORCE_INLINE_ uint32_t size() const { return table.size(); }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return table.size() == 0;
+	}
+
+	void clear() {
+		table.clear();
+	}
+
+	// Clears and releases the memory.
+	void reset() {
+		table.reset();
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t index = table.find_index(p_key);
+		CRASH_COND_MSG(index == INVALID_INDEX, "FlatHashMap key not found.");
+		return table.get_slot(index).value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t index = table.find_index(p_key);
+		CRASH_COND_MSG(index == INVALID_INDEX, "FlatHashMap key not found.");
+		return table.get_slot(index).value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t index = table.find_index(p_key);
+		return index == INVALID_INDEX ? nullptr : &table.get_slot(index).value;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t index = table.find_index(p_key);
+		return index == INVALID_INDEX ? nullptr : &table.get_slot(index).value;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return table.find_index(p_key) != INVALID_INDEX;
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t index = table.find_index(p_key);
+		if (index == INVALID_INDEX) {
+			return false;
+		}
+		table.erase_index(index);
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		table.reserve(p_new_capacity);
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return table->get_slot(index);
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return &table->get_slot(index); }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			if (index != INVALID_INDEX) {
+				index = table->next_index(index + 1);
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			if (index != INVALID_INDEX) {
+				index = index == 0 ? INVALID_INDEX : table->prev_index(index - 1);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return index != INVALID_INDEX;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const Table *p_table, uint32_t p_index) {
+			table = p_table;
+			index = p_index;
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		const Table *table = nullptr;
+		uint32_t index = INVALID_INDEX;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return table->get_slot(index);
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return &table->get_slot(index); }
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (index != INVALID_INDEX) {
+				index = table->next_index(index + 1);
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			if (index != INVALID_INDEX) {
+				index = index == 0 ? INVALID_INDEX : table->prev_index(index - 1);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return index != INVALID_INDEX;
+		}
+
+		_FORCE_INLINE_ Iterator(Table *p_table, uint32_t p_index) {
+			table = p_table;
+			index = p_index;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+		operator ConstIterator() const {
+			return ConstIterator(table, index);
+		}
+
+	private:
+		friend class FlatHashMap;
+		Table *table = nullptr;
+		uint32_t index = INVALID_INDEX;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(&table, table.next_index(0));
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(&table, INVALID_INDEX);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		return Iterator(&table, table.find_index(p_key));
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			table.erase_index(p_iter.index);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(&table, table.next_index(0));
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(&table, INVALID_INDEX);
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		return ConstIterator(&table, table.find_index(p_key));
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t index = table.find_index(p_key);
+		CRASH_COND(index == INVALID_INDEX);
+		return table.get_slot(index).value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t index = table.find_index(p_key);
+		if (index == INVALID_INDEX) {
+			index = _insert(p_key, TValue());
+			CRASH_COND(index == INVALID_INDEX);
+		}
+		return table.get_slot(index).value;
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		return Iterator(&table, _insert(p_key, p_value));
+	}
+
+	/* Constructors */
+
+	FlatHashMap(const FlatHashMap &p_other) {
+		table.copy_from(p_other.table);
+	}
+
+	FlatHashMap(FlatHashMap &&p_other) {
+		table.swap(p_other.table);
+	}
+
+	void operator=(const FlatHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		table.copy_from(p_other.table);
+	}
+
+	void operator=(FlatHashMap &&p_other) {
+		table.swap(p_other.table);
+	}
+
+	FlatHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	FlatHashMap() {}
+};
+
+} // namespace godot
+
+#endif // GODOT_FLAT_HASH_MAP_HPP
@@ -0,0 +1,194 @@
+/**************************************************************************/
+/*  flat_hash_set.hpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_FLAT_HASH_SET_HPP
+#define GODOT_FLAT_HASH_SET_HPP
+
+#include <godot_cpp/templates/flat_hash_table.hpp>
+
+namespace godot {
+
+/**
+ * A HashSet variant storing keys inline in an open addressing table (see
+ * FlatHashTable). Iteration follows slot order, not insertion order, and
+ * iterators stay valid until the table is rehashed.
+ */
+
+template <typename TKey>
+struct FlatHashSetGetKey {
+	static _FORCE_INLINE_ const TKey &get(const TKey &p_key) { return p_key; }
+};
+
+template <typename TKey,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class FlatHashSet {
+	typedef FlatHashTable<TKey, TKey, FlatHashSetGetKey<TKey>, Hasher, Comparator> Table;
+	static constexpr uint32_t INVALID_INDEX = Table::INVALID_INDEX;
+
+	Table table;
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return table.get_capacity(); }
+	_FORCE_INLINE_ uint32_t size() const { return table.size(); }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return table.size() == 0;
+	}
+
+	void clear() {
+		table.clear();
+	}
+
+	// Clears and releases the memory.
+	void reset() {
+		table.reset();
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		return table.find_index(p_key) != INVALID_INDEX;
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t index = table.find_index(p_key);
+		if (index == INVALID_INDEX) {
+			return false;
+		}
+		table.erase_index(index);
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	void reserve(uint32_t p_new_capacity) {
+		table.reserve(p_new_capacity);
+	}
+
+	/** Iterator API **/
+
+	struct Iterator {
+		_FORCE_INLINE_ const TKey &operator*() const {
+			return table->get_slot(index);
+		}
+		_FORCE_INLINE_ const TKey *operator->() const {
+			return &table->get_slot(index);
+		}
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (index != INVALID_INDEX) {
+				index = table->next_index(index + 1);
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			if (index != INVALID_INDEX) {
+				index = index == 0 ? INVALID_INDEX : table->prev_index(index - 1);
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return index == b.index; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return index != b.index; }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return index != INVALID_INDEX;
+		}
+
+		_FORCE_INLINE_ Iterator(const Table *p_table, uint32_t p_index) {
+			table = p_table;
+			index = p_index;
+		}
+		_FORCE_INLINE_ Iterator() {}
+
+	private:
+		friend class FlatHashSet;
+		const Table *table = nullptr;
+		uint32_t index = INVALID_INDEX;
+	};
+
+	_FORCE_INLINE_ Iterator begin() const {
+		return Iterator(&table, table.next_index(0));
+	}
+	_FORCE_INLINE_ Iterator end() const {
+		return Iterator(&table, INVALID_INDEX);
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) const {
+		return Iterator(&table, table.find_index(p_key));
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			table.erase_index(p_iter.index);
+		}
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key) {
+		bool inserted = false;
+		uint32_t index = table.prepare_insert(p_key, inserted);
+		ERR_FAIL_COND_V(index == INVALID_INDEX, end());
+		if (inserted) {
+			memnew_placement(&table.get_slot(index), TKey(p_key));
+		}
+		return Iterator(&table, index);
+	}
+
+	/* Constructors */
+
+	FlatHashSet(const FlatHashSet &p_other) {
+		table.copy_from(p_other.table);
+	}
+
+	FlatHashSet(FlatHashSet &&p_other) {
+		table.swap(p_other.table);
+	}
+
+	void operator=(const FlatHashSet &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		table.copy_from(p_other.table);
+	}
+
+	void operator=(FlatHashSet &&p_other) {
+		table.swap(p_other.table);
+	}
+
+	FlatHashSet(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	FlatHashSet() {}
+};
+
+} // namespace godot
+
+#endif // GODOT_FLAT_HASH_SET_HPP
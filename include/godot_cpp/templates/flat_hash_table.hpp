@@ -0,0 +1,433 @@
+/**************************************************************************/
+/*  flat_hash_table.hpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_FLAT_HASH_TABLE_HPP
+#define GODOT_FLAT_HASH_TABLE_HPP
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/templates/hashfuncs.hpp>
+
+#include <bit>
+#include <cstring>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define GODOT_FLAT_HASH_SSE2
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define GODOT_FLAT_HASH_NEON
+#endif
+
+namespace godot {
+
+/**
+ * Storage shared by FlatHashMap and FlatHashSet: an open addressing table in
+ * the style of Swiss tables.
+ *
+ * Every slot has one control byte, kept in a separate array: the low 7 bits
+ * of the key hash when the slot is full, or EMPTY / DELETED. Lookups load a
+ * whole group of control bytes at once (16 with SSE2, 8 otherwise) and only
+ * compare keys in slots whose 7 bits match, so most probes never touch a slot
+ * that does not hold the key. Slots are stored inline and never move while
+ * the table is not rehashed.
+ *
+ * Hashes are not stored, so growing the table calls Hasher again for every
+ * element. Prefer HashMap for keys that are expensive to hash.
+ */
+
+namespace flat_hash {
+
+static constexpr int8_t CTRL_EMPTY = -128;
+static constexpr int8_t CTRL_DELETED = -2;
+
+// Bit set of matching slots in a group, one bit every 2^SHIFT bits.
+template <typename T, uint32_t WIDTH, uint32_t SHIFT>
+struct BitMask {
+	T mask = 0;
+
+	_FORCE_INLINE_ explicit operator bool() const { return mask != 0; }
+	_FORCE_INLINE_ uint32_t lowest() const { return uint32_t(std::countr_zero(mask)) >> SHIFT; }
+	_FORCE_INLINE_ void clear_lowest() { mask &= mask - 1; }
+
+	// Slots before the first match, counting from the start of the group.
+	_FORCE_INLINE_ uint32_t trailing_zeros() const { return mask ? lowest() : WIDTH; }
+	// Slots after the last match, counting from the end of the group.
+	_FORCE_INLINE_ uint32_t leading_zeros() const {
+		constexpr uint32_t extra = sizeof(T) * 8 - (WIDTH << SHIFT);
+		return mask ? (uint32_t(std::countl_zero(mask)) - extra) >> SHIFT : WIDTH;
+	}
+};
+
+#ifdef GODOT_FLAT_HASH_SSE2
+
+struct Group {
+	static constexpr uint32_t WIDTH = 16;
+	typedef BitMask<uint32_t, WIDTH, 0> Mask;
+
+	__m128i ctrl;
+
+	_FORCE_INLINE_ explicit Group(const int8_t *p_ctrl) {
+		ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_ctrl));
+	}
+
+	_FORCE_INLINE_ Mask match(int8_t p_h2) const {
+		return Mask{ uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(p_h2), ctrl))) };
+	}
+	_FORCE_INLINE_ Mask match_empty() const {
+		return match(CTRL_EMPTY);
+	}
+	// EMPTY and DELETED are the only negative control bytes.
+	_FORCE_INLINE_ Mask match_empty_or_deleted() const {
+		return Mask{ uint32_t(_mm_movemask_epi8(ctrl)) };
+	}
+};
+
+#else
+
+// Portable version working on 8 control bytes packed in an uint64_t (little endian).
+struct Group {
+	static constexpr uint32_t WIDTH = 8;
+	typedef BitMask<uint64_t, WIDTH, 3> Mask;
+
+	static constexpr uint64_t LSBS = 0x0101010101010101ull;
+	static constexpr uint64_t MSBS = 0x8080808080808080ull;
+
+	static_assert(std::endian::native == std::endian::little);
+
+	uint64_t ctrl;
+
+	_FORCE_INLINE_ explicit Group(const int8_t *p_ctrl) {
+		memcpy(&ctrl, p_ctrl, sizeof(ctrl));
+	}
+
+	_FORCE_INLINE_ Mask match(int8_t p_h2) const {
+#ifdef GODOT_FLAT_HASH_NEON
+		uint8x8_t eq = vceq_s8(vdup_n_s8(p_h2), vreinterpret_s8_u64(vcreate_u64(ctrl)));
+		return Mask{ vget_lane_u64(vreinterpret_u64_u8(eq), 0) & MSBS };
+#else
+		// May report false positives next to a real match, which the key comparison filters out.
+		uint64_t x = ctrl ^ (LSBS * uint8_t(p_h2));
+		return Mask{ (x - LSBS) & ~x & MSBS };
+#endif
+	}
+	_FORCE_INLINE_ Mask match_empty() const {
+		// EMPTY is the only control byte with bit 7 set and bit 1 clear.
+		return Mask{ (ctrl & ~(ctrl << 6)) & MSBS };
+	}
+	_FORCE_INLINE_ Mask match_empty_or_deleted() const {
+		return Mask{ ctrl & MSBS };
+	}
+};
+
+#endif
+
+} // namespace flat_hash
+
+template <typename TKey, typename TSlot, typename GetKey, typename Hasher, typename Comparator>
+class FlatHashTable {
+public:
+	static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+	static constexpr uint32_t GROUP_WIDTH = flat_hash::Group::WIDTH;
+	static constexpr uint32_t MIN_CAPACITY = GROUP_WIDTH;
+
+private:
+	int8_t *ctrl = nullptr; // capacity + GROUP_WIDTH bytes, the tail mirrors the first group.
+	TSlot *slots = nullptr;
+	uint32_t capacity = 0; // Power of two, 0 until the first insertion.
+	uint32_t num_elements = 0;
+	uint32_t growth_left = 0; // Insertions into EMPTY slots left before a rehash.
+
+	_FORCE_INLINE_ static uint32_t _hash(const TKey &p_key) { return Hasher::hash(p_key); }
+	_FORCE_INLINE_ static uint32_t _h1(uint32_t p_hash) { return p_hash >> 7; }
+	_FORCE_INLINE_ static int8_t _h2(uint32_t p_hash) { return int8_t(p_hash & 0x7F); }
+
+	// 7/8 maximum load factor.
+	_FORCE_INLINE_ static uint32_t _max_elements(uint32_t p_capacity) { return p_capacity - p_capacity / 8; }
+
+	_FORCE_INLINE_ static size_t _ctrl_bytes(uint32_t p_capacity) {
+		constexpr size_t align = alignof(TSlot) > alignof(std::max_align_t) ? alignof(TSlot) : alignof(std::max_align_t);
+		return (size_t(p_capacity) + GROUP_WIDTH + align - 1) & ~(align - 1);
+	}
+
+	_FORCE_INLINE_ void _set_ctrl(uint32_t p_index, int8_t p_value) {
+		ctrl[p_index] = p_value;
+		// Keep the mirrored bytes after the end in sync, so a group can be loaded from any index.
+		ctrl[((p_index - GROUP_WIDTH) & (capacity - 1)) + GROUP_WIDTH] = p_value;
+	}
+
+	uint32_t _find_index(const TKey &p_key, uint32_t p_hash) const {
+		int8_t h2 = _h2(p_hash);
+		uint32_t mask = capacity - 1;
+		uint32_t pos = _h1(p_hash) & mask;
+		uint32_t step = 0;
+
+		while (true) {
+			flat_hash::Group group(ctrl + pos);
+			for (flat_hash::Group::Mask m = group.match(h2); m; m.clear_lowest()) {
+				uint32_t index = (pos + m.lowest()) & mask;
+				if (likely(Comparator::compare(GetKey::get(slots[index]), p_key))) {
+					return index;
+				}
+			}
+			if (likely(group.match_empty())) {
+				return INVALID_INDEX;
+			}
+			step += GROUP_WIDTH;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	uint32_t _find_insert_index(uint32_t p_hash) const {
+		uint32_t mask = capacity - 1;
+		uint32_t pos = _h1(p_hash) & mask;
+		uint32_t step = 0;
+		while (true) {
+			flat_hash::Group::Mask m = flat_hash::Group(ctrl + pos).match_empty_or_deleted();
+			if (m) {
+				return (pos + m.lowest()) & mask;
+			}
+			// Triangular probing over groups visits every group once.
+			step += GROUP_WIDTH;
+			pos = (pos + step) & mask;
+		}
+	}
+
+	void _allocate(uint32_t p_capacity) {
+		capacity = p_capacity;
+		size_t ctrl_size = _ctrl_bytes(capacity);
+		uint8_t *mem = reinterpret_cast<uint8_t *>(Memory::alloc_static(ctrl_size + sizeof(TSlot) * capacity));
+		ctrl = reinterpret_cast<int8_t *>(mem);
+		slots = reinterpret_cast<TSlot *>(mem + ctrl_size);
+		memset(ctrl, (uint8_t)flat_hash::CTRL_EMPTY, capacity + GROUP_WIDTH);
+		growth_left = _max_elements(capacity) - num_elements;
+	}
+
+	void _resize(uint32_t p_capacity) {
+		int8_t *old_ctrl = ctrl;
+		TSlot *old_slots = slots;
+		uint32_t old_capacity = capacity;
+
+		_allocate(p_capacity);
+
+		for (uint32_t i = 0; i < old_capacity; i++) {
+			if (old_ctrl[i] < 0) {
+				continue;
+			}
+			uint32_t hash = _hash(GetKey::get(old_slots[i]));
+			uint32_t index = _find_insert_index(hash);
+			_set_ctrl(index, _h2(hash));
+			memnew_placement(&slots[index], TSlot(std::move(old_slots[i])));
+			old_slots[i].~TSlot();
+		}
+
+		if (old_ctrl) {
+			Memory::free_static(old_ctrl);
+		}
+	}
+
+	void _grow() {
+		if (capacity == 0) {
+			_allocate(MIN_CAPACITY);
+		} else if (uint64_t(num_elements) * 32 <= uint64_t(capacity) * 25) {
+			// Mostly tombstones, clean them up without growing.
+			_resize(capacity);
+		} else {
+			ERR_FAIL_COND_MSG(capacity >= (1u << 31), "Hash table maximum capacity reached.");
+			_resize(capacity * 2);
+		}
+	}
+
+	void _destroy_slots() {
+		if constexpr (!std::is_trivially_destructible_v<TSlot>) {
+			for (uint32_t i = 0; i < capacity; i++) {
+				if (ctrl[i] >= 0) {
+					slots[i].~TSlot();
+				}
+			}
+		}
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+	_FORCE_INLINE_ TSlot &get_slot(uint32_t p_index) { return slots[p_index]; }
+	_FORCE_INLINE_ const TSlot &get_slot(uint32_t p_index) const { return slots[p_index]; }
+
+	// Whether p_ptr points into the slot storage, which an insertion may rehash.
+	_FORCE_INLINE_ bool owns_address(const void *p_ptr) const {
+		return uintptr_t(p_ptr) - uintptr_t(slots) < sizeof(TSlot) * capacity;
+	}
+
+	_FORCE_INLINE_ uint32_t find_index(const TKey &p_key) const {
+		if (num_elements == 0) {
+			return INVALID_INDEX;
+		}
+		return _find_index(p_key, _hash(p_key));
+	}
+
+	// Returns the index of p_key, or reserves a slot for it. When r_inserted is
+	// set, the caller must construct the slot with memnew_placement.
+	uint32_t prepare_insert(const TKey &p_key, bool &r_inserted) {
+		uint32_t hash = _hash(p_key);
+		uint32_t index = num_elements ? _find_index(p_key, hash) : INVALID_INDEX;
+		if (index != INVALID_INDEX) {
+			r_inserted = false;
+			return index;
+		}
+
+		if (capacity == 0) {
+			_grow();
+		}
+		index = _find_insert_index(hash);
+		if (unlikely(growth_left == 0 && ctrl[index] == flat_hash::CTRL_EMPTY)) {
+			_grow();
+			ERR_FAIL_COND_V(growth_left == 0, INVALID_INDEX);
+			index = _find_insert_index(hash);
+		}
+
+		if (ctrl[index] == flat_hash::CTRL_EMPTY) {
+			growth_left--;
+		}
+		_set_ctrl(index, _h2(hash));
+		num_elements++;
+		r_inserted = true;
+		return index;
+	}
+
+	void erase_index(uint32_t p_index) {
+		slots[p_index].~TSlot();
+		num_elements--;
+
+		// If no probe could have seen a full group around this slot, it can go
+		// back to EMPTY; otherwise a tombstone keeps longer probe chains intact.
+		uint32_t before = (p_index - GROUP_WIDTH) & (capacity - 1);
+		flat_hash::Group::Mask empty_after = flat_hash::Group(ctrl + p_index).match_empty();
+		flat_hash::Group::Mask empty_before = flat_hash::Group(ctrl + before).match_empty();
+		bool was_never_full = empty_before && empty_after && (empty_after.trailing_zeros() + empty_before.leading_zeros()) < GROUP_WIDTH;
+
+		_set_ctrl(p_index, was_never_full ? flat_hash::CTRL_EMPTY : flat_hash::CTRL_DELETED);
+		if (was_never_full) {
+			growth_left++;
+		}
+	}
+
+	// First full slot at or after p_index, or INVALID_INDEX.
+	_FORCE_INLINE_ uint32_t next_index(uint32_t p_index) const {
+		for (uint32_t i = p_index; i < capacity; i++) {
+			if (ctrl[i] >= 0) {
+				return i;
+			}
+		}
+		return INVALID_INDEX;
+	}
+
+	// Last full slot at or before p_index, or INVALID_INDEX.
+	_FORCE_INLINE_ uint32_t prev_index(uint32_t p_index) const {
+		for (uint32_t i = MIN(p_index, capacity - 1) + 1; i > 0; i--) {
+			if (ctrl[i - 1] >= 0) {
+				return i - 1;
+			}
+		}
+		return INVALID_INDEX;
+	}
+
+	void reserve(uint32_t p_elements) {
+		if (p_elements == 0) {
+			return;
+		}
+		uint32_t new_capacity = MAX(capacity, MIN_CAPACITY);
+		while (_max_elements(new_capacity) < p_elements) {
+			ERR_FAIL_COND_MSG(new_capacity >= (1u << 31), "Hash table maximum capacity reached.");
+			new_capacity *= 2;
+		}
+		if (new_capacity != capacity) {
+			_resize(new_capacity);
+		}
+	}
+
+	void clear() {
+		if (capacity == 0) {
+			return;
+		}
+		_destroy_slots();
+		memset(ctrl, (uint8_t)flat_hash::CTRL_EMPTY, capacity + GROUP_WIDTH);
+		num_elements = 0;
+		growth_left = _max_elements(capacity);
+	}
+
+	void reset() {
+		clear();
+		if (ctrl) {
+			Memory::free_static(ctrl);
+		}
+		ctrl = nullptr;
+		slots = nullptr;
+		capacity = 0;
+		growth_left = 0;
+	}
+
+	void copy_from(const FlatHashTable &p_other) {
+		reset();
+		if (p_other.num_elements == 0) {
+			return;
+		}
+		num_elements = p_other.num_elements;
+		_allocate(p_other.capacity);
+		growth_left = p_other.growth_left;
+		memcpy(ctrl, p_other.ctrl, capacity + GROUP_WIDTH);
+		for (uint32_t i = 0; i < capacity; i++) {
+			if (ctrl[i] >= 0) {
+				memnew_placement(&slots[i], TSlot(p_other.slots[i]));
+			}
+		}
+	}
+
+	void swap(FlatHashTable &p_other) {
+		SWAP(ctrl, p_other.ctrl);
+		SWAP(slots, p_other.slots);
+		SWAP(capacity, p_other.capacity);
+		SWAP(num_elements, p_other.num_elements);
+		SWAP(growth_left, p_other.growth_left);
+	}
+
+	FlatHashTable() {}
+	FlatHashTable(const FlatHashTable &) = delete;
+	void operator=(const FlatHashTable &) = delete;
+
+	~FlatHashTable() {
+		reset();
+	}
+};
+
+} // namespace godot
+
+#endif // GODOT_FLAT_HASH_TABLE_HPP
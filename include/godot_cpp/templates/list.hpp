@@ -45,7 +45,7 @@
 
 namespace godot {
 
-template <typename T, typename A = DefaultAllocator>
+template <typename T, typename A = DefaultNodeAllocator>
 class List {
 	struct _Data;
 
@@ -31,6 +31,8 @@
 #ifndef GODOT_PAIR_HPP
 #define GODOT_PAIR_HPP
 
+#include <utility>
+
 namespace godot {
 
 template <typename F, typename S>
@@ -79,6 +81,11 @@ struct KeyValue {
 			key(p_kv.key),
 			value(p_kv.value) {
 	}
+	// The key is const, so only the value can be moved.
+	_FORCE_INLINE_ KeyValue(KeyValue &&p_kv) :
+			key(p_kv.key),
+			value(std::move(p_kv.value)) {
+	}
 	_FORCE_INLINE_ KeyValue(const K &p_key, const V &p_value) :
 			key(p_key),
 			value(p_value) {
@@ -40,7 +40,7 @@ namespace godot {
 // based on the very nice implementation of rb-trees by:
 // https://web.archive.org/web/20120507164830/https://web.mit.edu/~emin/www/source_code/red_black_tree/index.html
 
-template <typename K, typename V, typename C = Comparator<K>, typename A = DefaultAllocator>
+template <typename K, typename V, typename C = Comparator<K>, typename A = DefaultNodeAllocator>
 class RBMap {
 	enum Color {
 		RED,
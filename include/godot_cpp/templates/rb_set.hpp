@@ -38,7 +38,7 @@
 
 namespace godot {
 
-template <typename T, typename C = Comparator<T>, typename A = DefaultAllocator>
+template <typename T, typename C = Comparator<T>, typename A = DefaultNodeAllocator>
 class RBSet {
 	enum Color {
 		RED,
@@ -31,82 +31,237 @@
 #ifndef GODOT_RID_OWNER_HPP
 #define GODOT_RID_OWNER_HPP
 
+#include <godot_cpp/core/math.hpp>
 #include <godot_cpp/core/memory.hpp>
 #include <godot_cpp/godot.hpp>
 #include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/templates/spin_lock.hpp>
-#include <godot_cpp/variant/utility_functions.hpp>
+#include <godot_cpp/variant/rid.hpp>
 
+#include <atomic>
 #include <cstdio>
+#include <cstring>
 #include <typeinfo>
 
 namespace godot {
 
+class RID_AllocBase {
+	static inline std::atomic<uint64_t> base_id{ 1 };
+	static inline std::atomic<uint32_t> thread_counter{ 0 };
+
+protected:
+	// Validators are reserved from the shared counter in blocks, so that
+	// allocating a RID never has to call into the engine or touch a shared
+	// cache line.
+	//
+	// The counter is private to this extension and starts at 1, so unlike
+	// UtilityFunctions::rid_allocate_id() it is not unique against the engine
+	// or other extensions: a RID made elsewhere can carry the index and
+	// validator of a live element here. Only pass RIDs made by this owner.
+	static constexpr uint32_t VALIDATOR_BLOCK_SIZE = 1024;
+
+	static _FORCE_INLINE_ uint32_t _gen_validator() {
+		static thread_local uint64_t next = 0;
+		static thread_local uint64_t end = 0;
+		if (unlikely(next == end)) {
+			next = base_id.fetch_add(VALIDATOR_BLOCK_SIZE, std::memory_order_relaxed);
+			end = next + VALIDATOR_BLOCK_SIZE;
+		}
+		// In [1, 0x7FFFFFFE]: zero would make the first RID equal to RID(), and
+		// 0x7FFFFFFF with the uninitialized bit set would read as a free slot.
+		return uint32_t(next++ % 0x7FFFFFFE) + 1;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_thread_index() {
+		static thread_local uint32_t index = thread_counter.fetch_add(1, std::memory_order_relaxed);
+		return index;
+	}
+
+	// RID is an opaque 64-bit id, read and written directly to avoid a round
+	// trip through the engine on every lookup.
+	static _FORCE_INLINE_ uint64_t _get_id(const RID &p_rid) {
+		static_assert(sizeof(RID) == sizeof(uint64_t));
+		uint64_t id;
+		memcpy(&id, p_rid._native_ptr(), sizeof(id));
+		return id;
+	}
+
+	static _FORCE_INLINE_ RID _make_from_id(uint64_t p_id) {
+		RID rid;
+		memcpy(rid._native_ptr(), &p_id, sizeof(p_id));
+		return rid;
+	}
+};
+
+/**
+ * Chunked storage for RID-addressed elements.
+ *
+ * With THREAD_SAFE, get_or_null() and owns() do not lock: chunks are never
+ * moved once allocated, the table pointing to them is published with
+ * release/acquire ordering (old tables are only freed on destruction), and
+ * validators are atomics. Allocation and freeing go through a small set of
+ * per-thread free index caches, and only take the global lock to move a
+ * batch of indices in or out of the shared free list.
+ *
+ * Validators come from a counter local to the extension (see _gen_validator),
+ * so owns() and get_or_null() may return a false positive for a RID made by
+ * the engine or another extension. They only reject stale RIDs of this owner.
+ */
+
 template <typename T, bool THREAD_SAFE = false>
-class RID_Alloc {
-	T **chunks = nullptr;
-	uint32_t **free_list_chunks = nullptr;
-	uint32_t **validator_chunks = nullptr;
+class RID_Alloc : public RID_AllocBase {
+	static constexpr uint32_t VALIDATOR_FREE = 0xFFFFFFFF;
+	static constexpr uint32_t VALIDATOR_UNINITIALIZED = 0x80000000;
+
+	static constexpr uint32_t FREE_CACHE_COUNT = 16; // Power of two.
+	static constexpr uint32_t FREE_CACHE_SIZE = 64;
+	static constexpr uint32_t FREE_CACHE_BATCH = FREE_CACHE_SIZE / 2;
+
+	struct ChunkTable {
+		ChunkTable *prev = nullptr; // Replaced tables, kept alive for concurrent readers.
+		uint32_t capacity = 0;
+		T **chunks = nullptr;
+		std::atomic<uint32_t> **validator_chunks = nullptr;
+	};
+
+	struct FreeCache {
+		SpinLock lock;
+		uint32_t count = 0;
+		uint32_t indices[FREE_CACHE_SIZE];
+	};
+
+	std::atomic<ChunkTable *> chunk_table = nullptr;
+	std::atomic<uint32_t> max_alloc = 0;
+	std::atomic<uint32_t> alloc_count = 0;
+
+	// Shared free list, only accessed with spin_lock held in THREAD_SAFE mode.
+	// Entries from taken_count to max_alloc are free indices.
+	uint32_t *free_list = nullptr;
+	uint32_t taken_count = 0;
+
+	FreeCache *free_caches = nullptr;
 
 	uint32_t elements_in_chunk;
-	uint32_t max_alloc = 0;
-	uint32_t alloc_count = 0;
 
 	const char *description = nullptr;
 
 	SpinLock spin_lock;
 
-	_FORCE_INLINE_ RID _allocate_rid() {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
+	void _grow() {
+		uint32_t old_max_alloc = max_alloc.load(std::memory_order_relaxed);
+		uint32_t chunk_count = old_max_alloc / elements_in_chunk;
+
+		ChunkTable *table = chunk_table.load(std::memory_order_relaxed);
+		if (table == nullptr || chunk_count == table->capacity) {
+			ChunkTable *new_table = memnew(ChunkTable);
+			new_table->capacity = table ? table->capacity * 2 : 8;
+			new_table->chunks = (T **)memalloc(sizeof(T *) * new_table->capacity);
+			new_table->validator_chunks = (std::atomic<uint32_t> **)memalloc(sizeof(std::atomic<uint32_t> *) * new_table->capacity);
+			for (uint32_t i = 0; i < chunk_count; i++) {
+				new_table->chunks[i] = table->chunks[i];
+				new_table->validator_chunks[i] = table->validator_chunks[i];
+			}
+			new_table->prev = table;
+			table = new_table;
+			chunk_table.store(table, std::memory_order_release);
 		}
 
-		if (alloc_count == max_alloc) {
-			// allocate a new chunk
-			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
-
-			// grow chunks
-			chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
-			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); // but don't initialize
-
-			// grow validators
-			validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			validator_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
-			// grow free lists
-			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
-
-			// initialize
-			for (uint32_t i = 0; i < elements_in_chunk; i++) {
-				// Don't initialize chunk.
-				validator_chunks[chunk_count][i] = 0xFFFFFFFF;
-				free_list_chunks[chunk_count][i] = alloc_count + i;
-			}
+		table->chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); // but don't initialize
+		std::atomic<uint32_t> *validators = (std::atomic<uint32_t> *)memalloc(sizeof(std::atomic<uint32_t>) * elements_in_chunk);
+		for (uint32_t i = 0; i < elements_in_chunk; i++) {
+			memnew_placement(&validators[i], std::atomic<uint32_t>(VALIDATOR_FREE));
+		}
+		table->validator_chunks[chunk_count] = validators;
+
+		free_list = (uint32_t *)memrealloc(free_list, sizeof(uint32_t) * (old_max_alloc + elements_in_chunk));
+		for (uint32_t i = 0; i < elements_in_chunk; i++) {
+			free_list[old_max_alloc + i] = old_max_alloc + i;
+		}
+
+		// Publishes the new chunk to lock-free readers.
+		max_alloc.store(old_max_alloc + elements_in_chunk, std::memory_order_release);
+	}
 
-			max_alloc += elements_in_chunk;
+	// Moves up to p_count free indices out of the shared free list, growing it if empty.
+	uint32_t _take_free_indices(uint32_t *r_indices, uint32_t p_count) {
+		if (taken_count == max_alloc.load(std::memory_order_relaxed)) {
+			_grow();
 		}
+		uint32_t count = MIN(p_count, max_alloc.load(std::memory_order_relaxed) - taken_count);
+		for (uint32_t i = 0; i < count; i++) {
+			r_indices[i] = free_list[taken_count++];
+		}
+		return count;
+	}
 
-		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
+	void _return_free_indices(const uint32_t *p_indices, uint32_t p_count) {
+		for (uint32_t i = 0; i < p_count; i++) {
+			free_list[--taken_count] = p_indices[i];
+		}
+	}
 
-		uint32_t free_chunk = free_index / elements_in_chunk;
-		uint32_t free_element = free_index % elements_in_chunk;
+	// Returns the validator of p_index, or nullptr if it is out of range.
+	_FORCE_INLINE_ std::atomic<uint32_t> *_get_validator(uint32_t p_index) const {
+		if (unlikely(p_index >= max_alloc.load(std::memory_order_acquire))) {
+			return nullptr;
+		}
+		ChunkTable *table = chunk_table.load(std::memory_order_acquire);
+		return &table->validator_chunks[p_index / elements_in_chunk][p_index % elements_in_chunk];
+	}
 
-		uint32_t validator = (uint32_t)(UtilityFunctions::rid_allocate_id() & 0x7FFFFFFF);
+	_FORCE_INLINE_ T *_get_element(uint32_t p_index) const {
+		ChunkTable *table = chunk_table.load(std::memory_order_acquire);
+		return &table->chunks[p_index / elements_in_chunk][p_index % elements_in_chunk];
+	}
+
+	_FORCE_INLINE_ RID _allocate_rid() {
+		uint32_t free_index;
+
+		if (THREAD_SAFE) {
+			FreeCache &cache = free_caches[_get_thread_index() & (FREE_CACHE_COUNT - 1)];
+			cache.lock.lock();
+			if (cache.count == 0) {
+				spin_lock.lock();
+				cache.count = _take_free_indices(cache.indices, FREE_CACHE_BATCH);
+				spin_lock.unlock();
+			}
+			free_index = cache.indices[--cache.count];
+			cache.lock.unlock();
+		} else {
+			_take_free_indices(&free_index, 1);
+		}
+
+		uint32_t validator = _gen_validator();
 		uint64_t id = validator;
 		id <<= 32;
 		id |= free_index;
 
-		validator_chunks[free_chunk][free_element] = validator;
+		_get_validator(free_index)->store(validator | VALIDATOR_UNINITIALIZED, std::memory_order_relaxed); // mark uninitialized bit
 
-		validator_chunks[free_chunk][free_element] |= 0x80000000; // mark uninitialized bit
+		alloc_count.fetch_add(1, std::memory_order_relaxed);
 
-		alloc_count++;
+		return _make_from_id(id);
+	}
 
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
+	// Returns the storage of an allocated but not yet initialized RID.
+	T *_get_uninitialized(uint64_t p_id, std::atomic<uint32_t> *&r_validator) {
+		uint32_t idx = uint32_t(p_id & 0xFFFFFFFF);
+		uint32_t validator = uint32_t(p_id >> 32);
+
+		r_validator = _get_validator(idx);
+		if (unlikely(!r_validator)) {
+			return nullptr;
 		}
 
-		return UtilityFunctions::rid_from_int64(id);
+		uint32_t current = r_validator->load(std::memory_order_relaxed);
+		if (unlikely(!(current & VALIDATOR_UNINITIALIZED))) {
+			ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
+		}
+		if (unlikely((current & 0x7FFFFFFF) != validator)) {
+			ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
+		}
+
+		return _get_element(idx);
 	}
 
 public:
@@ -127,178 +282,123 @@ public:
 	}
 
 	_FORCE_INLINE_ T *get_or_null(const RID &p_rid, bool p_initialize = false) {
-		if (p_rid == RID()) {
+		uint64_t id = _get_id(p_rid);
+		if (id == 0) {
 			return nullptr;
 		}
-		if (THREAD_SAFE) {
-			spin_lock.lock();
+
+		if (unlikely(p_initialize)) {
+			std::atomic<uint32_t> *validator = nullptr;
+			T *ptr = _get_uninitialized(id, validator);
+			if (ptr) {
+				validator->store(uint32_t(id >> 32), std::memory_order_release); // initialized
+			}
+			return ptr;
 		}
 
-		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		std::atomic<uint32_t> *validator = _get_validator(idx);
+		if (unlikely(!validator)) {
 			return nullptr;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
-		uint32_t validator = uint32_t(id >> 32);
-
-		if (unlikely(p_initialize)) {
-			if (unlikely(!(validator_chunks[idx_chunk][idx_element] & 0x80000000))) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
-			}
-
-			if (unlikely((validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) != validator)) {
-				if (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
-				return nullptr;
-			}
-
-			validator_chunks[idx_chunk][idx_element] &= 0x7FFFFFFF; // initialized
-
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
-			if ((validator_chunks[idx_chunk][idx_element] & 0x80000000) && validator_chunks[idx_chunk][idx_element] != 0xFFFFFFFF) {
+		uint32_t current = validator->load(std::memory_order_acquire);
+		if (unlikely(current != uint32_t(id >> 32))) {
+			if ((current & VALIDATOR_UNINITIALIZED) && current != VALIDATOR_FREE) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
 		}
 
-		T *ptr = &chunks[idx_chunk][idx_element];
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return ptr;
+		return _get_element(idx);
 	}
 	void initialize_rid(RID p_rid) {
-		T *mem = get_or_null(p_rid, true);
+		uint64_t id = _get_id(p_rid);
+		std::atomic<uint32_t> *validator = nullptr;
+		T *mem = _get_uninitialized(id, validator);
 		ERR_FAIL_NULL(mem);
 		memnew_placement(mem, T);
+		// Only make the element visible to lock-free readers once it is constructed.
+		validator->store(uint32_t(id >> 32), std::memory_order_release);
 	}
 	void initialize_rid(RID p_rid, const T &p_value) {
-		T *mem = get_or_null(p_rid, true);
+		uint64_t id = _get_id(p_rid);
+		std::atomic<uint32_t> *validator = nullptr;
+		T *mem = _get_uninitialized(id, validator);
 		ERR_FAIL_NULL(mem);
 		memnew_placement(mem, T(p_value));
+		validator->store(uint32_t(id >> 32), std::memory_order_release);
 	}
 
-	_FORCE_INLINE_ bool owns(const RID &p_rid) {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-
-		uint64_t id = p_rid.get_id();
-		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
+		uint64_t id = _get_id(p_rid);
+		std::atomic<uint32_t> *validator = _get_validator(uint32_t(id & 0xFFFFFFFF));
+		if (unlikely(!validator)) {
 			return false;
 		}
-
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
-		uint32_t validator = uint32_t(id >> 32);
-
-		bool owned = (validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) == validator;
-
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return owned;
+		return (validator->load(std::memory_order_acquire) & 0x7FFFFFFF) == uint32_t(id >> 32);
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-
-		uint64_t id = p_rid.get_id();
+		uint64_t id = _get_id(p_rid);
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
-			ERR_FAIL();
-		}
+		std::atomic<uint32_t> *validator = _get_validator(idx);
+		ERR_FAIL_NULL(validator);
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
-		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(validator_chunks[idx_chunk][idx_element] & 0x80000000)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		uint32_t expected = uint32_t(id >> 32);
+		uint32_t current = validator->load(std::memory_order_relaxed);
+		if (unlikely(current & VALIDATOR_UNINITIALIZED)) {
 			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
-			if (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
-			ERR_FAIL();
 		}
+		// Invalidating atomically makes a concurrent double free fail here
+		// instead of destroying the element twice.
+		ERR_FAIL_COND(current != expected || !validator->compare_exchange_strong(expected, VALIDATOR_FREE, std::memory_order_acq_rel));
 
-		chunks[idx_chunk][idx_element].~T();
-		validator_chunks[idx_chunk][idx_element] = 0xFFFFFFFF; // go invalid
-
-		alloc_count--;
-		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
+		_get_element(idx)->~T();
 
 		if (THREAD_SAFE) {
-			spin_lock.unlock();
+			FreeCache &cache = free_caches[_get_thread_index() & (FREE_CACHE_COUNT - 1)];
+			cache.lock.lock();
+			if (cache.count == FREE_CACHE_SIZE) {
+				cache.count -= FREE_CACHE_BATCH;
+				spin_lock.lock();
+				_return_free_indices(&cache.indices[cache.count], FREE_CACHE_BATCH);
+				spin_lock.unlock();
+			}
+			cache.indices[cache.count++] = idx;
+			cache.lock.unlock();
+		} else {
+			_return_free_indices(&idx, 1);
 		}
+
+		alloc_count.fetch_sub(1, std::memory_order_relaxed);
 	}
 
 	_FORCE_INLINE_ uint32_t get_rid_count() const {
-		return alloc_count;
+		return alloc_count.load(std::memory_order_relaxed);
 	}
 
 	void get_owned_list(List<RID> *p_owned) {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
-			if (validator != 0xFFFFFFFF) {
-				p_owned->push_back(UtilityFunctions::rid_from_int64((validator << 32) | i));
+		uint32_t count = max_alloc.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < count; i++) {
+			uint64_t validator = _get_validator(i)->load(std::memory_order_acquire);
+			if (validator != VALIDATOR_FREE) {
+				p_owned->push_back(_make_from_id((validator << 32) | i));
 			}
 		}
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
 	}
 
 	// used for fast iteration in the elements or RIDs
 	void fill_owned_buffer(RID *p_rid_buffer) {
-		if (THREAD_SAFE) {
-			spin_lock.lock();
-		}
 		uint32_t idx = 0;
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
-			if (validator != 0xFFFFFFFF) {
-				p_rid_buffer[idx] = UtilityFunctions::rid_from_int64((validator << 32) | i);
+		uint32_t count = max_alloc.load(std::memory_order_acquire);
+		for (uint32_t i = 0; i < count; i++) {
+			uint64_t validator = _get_validator(i)->load(std::memory_order_acquire);
+			if (validator != VALIDATOR_FREE) {
+				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
 			}
 		}
-		if (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
 	}
 
 	void set_description(const char *p_descrption) {
@@ -307,42 +407,54 @@ public:
 
 	RID_Alloc(uint32_t p_target_chunk_byte_size = 65536) {
 		elements_in_chunk = sizeof(T) > p_target_chunk_byte_size ? 1 : (p_target_chunk_byte_size / sizeof(T));
+		if (THREAD_SAFE) {
+			free_caches = memnew_arr(FreeCache, FREE_CACHE_COUNT);
+		}
 	}
 
 	~RID_Alloc() {
-		if (alloc_count) {
+		uint32_t count = alloc_count.load(std::memory_order_relaxed);
+		uint32_t total = max_alloc.load(std::memory_order_relaxed);
+		if (count) {
 			if (description) {
-				printf("ERROR: %d  RID allocations of type '%s' were leaked at exit.", alloc_count, description);
+				printf("ERROR: %d  RID allocations of type '%s' were leaked at exit.", count, description);
 			} else {
 #ifdef NO_SAFE_CAST
-				printf("ERROR: %d RID allocations of type 'unknown' were leaked at exit.", alloc_count);
+				printf("ERROR: %d RID allocations of type 'unknown' were leaked at exit.", count);
 #else
-				printf("ERROR: %d RID allocations of type '%s' were leaked at exit.", alloc_count, typeid(T).name());
+				printf("ERROR: %d RID allocations of type '%s' were leaked at exit.", count, typeid(T).name());
 #endif
 			}
 
-			for (size_t i = 0; i < max_alloc; i++) {
-				uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
-				if (validator & 0x80000000) {
-					continue; // uninitialized
-				}
-				if (validator != 0xFFFFFFFF) {
-					chunks[i / elements_in_chunk][i % elements_in_chunk].~T();
+			for (uint32_t i = 0; i < total; i++) {
+				uint32_t validator = _get_validator(i)->load(std::memory_order_relaxed);
+				if (validator & VALIDATOR_UNINITIALIZED) {
+					continue; // uninitialized or free
 				}
+				_get_element(i)->~T();
 			}
 		}
 
-		uint32_t chunk_count = max_alloc / elements_in_chunk;
+		ChunkTable *table = chunk_table.load(std::memory_order_relaxed);
+		uint32_t chunk_count = total / elements_in_chunk;
 		for (uint32_t i = 0; i < chunk_count; i++) {
-			memfree(chunks[i]);
-			memfree(validator_chunks[i]);
-			memfree(free_list_chunks[i]);
+			memfree(table->chunks[i]);
+			memfree(table->validator_chunks[i]);
 		}
 
-		if (chunks) {
-			memfree(chunks);
-			memfree(free_list_chunks);
-			memfree(validator_chunks);
+		while (table) {
+			ChunkTable *prev = table->prev;
+			memfree(table->chunks);
+			memfree(table->validator_chunks);
+			memdelete(table);
+			table = prev;
+		}
+
+		if (free_list) {
+			memfree(free_list);
+		}
+		if (free_caches) {
+			memdelete_arr(free_caches);
 		}
 	}
 };
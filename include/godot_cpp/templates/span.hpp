@@ -0,0 +1,87 @@
+/**************************************************************************/
+/*  span.hpp                                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_SPAN_HPP
+#define GODOT_SPAN_HPP
+
+#include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace godot {
+
+/**
+ * Non-owning view over contiguous elements, like std::span.
+ *
+ * Use Span<const T> for read-only access. A span does not keep its source
+ * alive, and is invalidated by anything that reallocates or copies the
+ * source on write, such as resizing a packed array.
+ */
+
+template <typename T>
+class Span {
+	T *_ptr = nullptr;
+	uint64_t _len = 0;
+
+public:
+	_FORCE_INLINE_ constexpr Span() = default;
+	_FORCE_INLINE_ constexpr Span(T *p_ptr, uint64_t p_len) :
+			_ptr(p_ptr), _len(p_len) {}
+
+	// Allows passing a mutable span where a read-only one is expected.
+	template <typename U>
+		requires std::is_convertible_v<U (*)[], T (*)[]>
+	_FORCE_INLINE_ constexpr Span(const Span<U> &p_other) :
+			_ptr(p_other.ptr()), _len(p_other.size()) {}
+
+	_FORCE_INLINE_ constexpr uint64_t size() const { return _len; }
+	_FORCE_INLINE_ constexpr bool is_empty() const { return _len == 0; }
+
+	_FORCE_INLINE_ constexpr T *ptr() const { return _ptr; }
+
+	_FORCE_INLINE_ constexpr T &operator[](uint64_t p_index) const {
+		DEV_ASSERT(p_index < _len);
+		return _ptr[p_index];
+	}
+
+	_FORCE_INLINE_ constexpr T *begin() const { return _ptr; }
+	_FORCE_INLINE_ constexpr T *end() const { return _ptr + _len; }
+
+	_FORCE_INLINE_ constexpr Span subspan(uint64_t p_from, uint64_t p_len) const {
+		DEV_ASSERT(p_from <= _len && p_len <= _len - p_from);
+		return Span(_ptr + p_from, p_len);
+	}
+};
+
+} // namespace godot
+
+#endif // GODOT_SPAN_HPP
@@ -31,22 +31,170 @@
 #ifndef GODOT_SPIN_LOCK_HPP
 #define GODOT_SPIN_LOCK_HPP
 
+#include <godot_cpp/core/defs.hpp>
+
 #include <atomic>
+#include <cstdint>
+#include <thread>
+
+#ifdef SPIN_LOCK_STATS
+#include <chrono>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
 
 namespace godot {
 
+// Hints the CPU that the calling thread is spinning.
+_ALWAYS_INLINE_ void cpu_pause() {
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	_mm_pause();
+#elif defined(__aarch64__) || (defined(__arm__) && __ARM_ARCH >= 7)
+	__asm__ __volatile__("yield");
+#elif defined(_M_ARM64) || defined(_M_ARM)
+	__yield();
+#endif
+}
+
+/**
+ * Test-and-test-and-set lock with exponential backoff.
+ *
+ * Waiters spin on a plain load, so the cache line is only written when the
+ * lock looks free. After SPIN_COUNT rounds of backoff a waiter parks on the
+ * lock word (futex on Linux, WaitOnAddress on Windows) until the holder
+ * releases it. Define SPIN_LOCK_DISABLE_PARKING to yield the thread instead.
+ *
+ * Define SPIN_LOCK_STATS to record acquisitions and contention per lock,
+ * readable with get_stats().
+ */
+
 class SpinLock {
-	std::atomic_flag locked = ATOMIC_FLAG_INIT;
+	enum : uint8_t {
+		UNLOCKED,
+		LOCKED,
+		LOCKED_CONTENDED, // Locked, and some waiter may be parked.
+	};
+
+	static constexpr uint32_t SPIN_COUNT = 64;
+	static constexpr uint32_t MAX_BACKOFF = 64; // In pause instructions.
+
+	std::atomic<uint8_t> state = UNLOCKED;
+
+#ifdef SPIN_LOCK_STATS
+public:
+	struct Stats {
+		uint64_t acquisitions = 0;
+		uint64_t contended = 0; // Acquisitions that did not get the lock at the first attempt.
+		uint64_t spins = 0; // Backoff rounds over all contended acquisitions.
+		uint64_t parks = 0;
+		uint64_t max_wait_usec = 0;
+	};
+
+private:
+	Stats stats; // Only written while holding the lock.
+#endif
+
+	void _lock_slow() {
+#ifdef SPIN_LOCK_STATS
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		uint64_t spins = 0;
+		uint64_t parks = 0;
+#endif
+		uint32_t backoff = 1;
+		uint32_t rounds = 0;
+		while (true) {
+			uint8_t current = state.load(std::memory_order_relaxed);
+			if (current == UNLOCKED) {
+				if (state.compare_exchange_weak(current, LOCKED, std::memory_order_acquire, std::memory_order_relaxed)) {
+					break;
+				}
+				continue;
+			}
+
+			if (rounds < SPIN_COUNT) {
+				for (uint32_t i = 0; i < backoff; i++) {
+					cpu_pause();
+				}
+				backoff = backoff < MAX_BACKOFF ? backoff * 2 : MAX_BACKOFF;
+				rounds++;
+#ifdef SPIN_LOCK_STATS
+				spins++;
+#endif
+				continue;
+			}
+
+#ifdef SPIN_LOCK_DISABLE_PARKING
+			std::this_thread::yield();
+#else
+			// Take the lock in the contended state from now on, since other
+			// waiters may be parked and need a wake up on unlock.
+			while (state.exchange(LOCKED_CONTENDED, std::memory_order_acquire) != UNLOCKED) {
+				state.wait(LOCKED_CONTENDED, std::memory_order_relaxed);
+#ifdef SPIN_LOCK_STATS
+				parks++;
+#endif
+			}
+			break;
+#endif
+		}
+
+#ifdef SPIN_LOCK_STATS
+		uint64_t wait = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+		stats.contended++;
+		stats.spins += spins;
+		stats.parks += parks;
+		stats.max_wait_usec = wait > stats.max_wait_usec ? wait : stats.max_wait_usec;
+#endif
+	}
 
 public:
 	_ALWAYS_INLINE_ void lock() {
-		while (locked.test_and_set(std::memory_order_acquire)) {
-			;
+		uint8_t expected = UNLOCKED;
+		if (unlikely(!state.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire, std::memory_order_relaxed))) {
+			_lock_slow();
+		}
+#ifdef SPIN_LOCK_STATS
+		stats.acquisitions++;
+#endif
+	}
+
+	_ALWAYS_INLINE_ bool try_lock() {
+		uint8_t expected = UNLOCKED;
+		if (state.load(std::memory_order_relaxed) != UNLOCKED || !state.compare_exchange_strong(expected, LOCKED, std::memory_order_acquire, std::memory_order_relaxed)) {
+			return false;
 		}
+#ifdef SPIN_LOCK_STATS
+		stats.acquisitions++;
+#endif
+		return true;
 	}
+
 	_ALWAYS_INLINE_ void unlock() {
-		locked.clear(std::memory_order_release);
+#ifdef SPIN_LOCK_DISABLE_PARKING
+		state.store(UNLOCKED, std::memory_order_release);
+#else
+		if (unlikely(state.exchange(UNLOCKED, std::memory_order_release) == LOCKED_CONTENDED)) {
+			state.notify_one();
+		}
+#endif
+	}
+
+#ifdef SPIN_LOCK_STATS
+	Stats get_stats() {
+		lock();
+		Stats result = stats;
+		unlock();
+		return result;
+	}
+
+	void reset_stats() {
+		lock();
+		stats = Stats();
+		unlock();
 	}
+#endif
 };
 
 } // namespace godot
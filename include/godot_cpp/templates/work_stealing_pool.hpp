@@ -0,0 +1,557 @@
+/**************************************************************************/
+/*  work_stealing_pool.hpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_WORK_STEALING_POOL_HPP
+#define GODOT_WORK_STEALING_POOL_HPP
+
+#include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/memory.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <thread>
+
+namespace godot {
+
+/**
+ * A work-stealing alternative to ThreadWorkPool.
+ *
+ * Work is submitted as a group of indices [0, elements). A group starts as a
+ * single range task; whoever executes a range splits it in halves (lazy binary
+ * splitting) only while its own deque runs dry, so the grain adapts to how much
+ * stealing actually happens instead of handing out one index per atomic
+ * operation. Each worker owns a Chase-Lev deque: the owner pushes and pops at
+ * the bottom, idle workers steal from the top.
+ *
+ * Unlike ThreadWorkPool, several groups can be in flight at once and
+ * do_work() may be called from inside a work function (nested fork/join). A
+ * thread waiting on a group keeps executing pending tasks instead of blocking.
+ *
+ * Blocking do_work() keeps its group on the caller's stack, and groups started
+ * with begin_work() live in a fixed table allocated by init(), so no memory is
+ * allocated per batch.
+ */
+
+class WorkStealingPool {
+public:
+	typedef int64_t GroupID;
+
+	static constexpr GroupID INVALID_GROUP_ID = -1;
+	static constexpr uint32_t MAX_GROUPS = 64; // Groups in flight started by begin_work().
+	static constexpr uint32_t DEQUE_SIZE = 1024; // Must be a power of two.
+	static constexpr uint32_t SPLIT_THRESHOLD = 2; // Only split while the local deque holds fewer tasks than this.
+	static constexpr uint32_t TASKS_PER_THREAD = 8; // Used to derive the grain when none is given.
+
+private:
+	struct Group {
+		std::atomic<uint32_t> pending; // Indices not completed yet.
+		uint32_t grain = 1;
+		void (*run)(Group *, uint32_t, uint32_t) = nullptr;
+		void (*destroy)(Group *) = nullptr;
+	};
+
+	template <typename C, typename M, typename U>
+	struct Work : public Group {
+		C *instance;
+		M method;
+		U userdata;
+
+		static void run_range(Group *p_group, uint32_t p_from, uint32_t p_to) {
+			Work *w = static_cast<Work *>(p_group);
+			for (uint32_t i = p_from; i < p_to; i++) {
+				(w->instance->*w->method)(i, w->userdata);
+			}
+		}
+
+		static void destroy_work(Group *p_group) {
+			static_cast<Work *>(p_group)->~Work();
+		}
+
+		Work(C *p_instance, M p_method, U p_userdata) :
+				instance(p_instance), method(p_method), userdata(p_userdata) {
+			run = &run_range;
+			destroy = &destroy_work;
+		}
+	};
+
+	struct Task {
+		Group *group = nullptr;
+		uint32_t from = 0;
+		uint32_t to = 0;
+	};
+
+	// Chase-Lev deque, see "Correct and Efficient Work-Stealing for Weak Memory
+	// Models" (Lê et al., 2013). Fixed size; a full deque makes the caller run
+	// the task inline rather than grow the buffer.
+	struct Deque {
+		struct Slot {
+			std::atomic<Group *> group = nullptr;
+			std::atomic<uint64_t> range = 0;
+		};
+
+		alignas(64) std::atomic<int64_t> top = 0;
+		alignas(64) std::atomic<int64_t> bottom = 0;
+		alignas(64) Slot slots[DEQUE_SIZE];
+
+		_FORCE_INLINE_ void _write(int64_t p_index, const Task &p_task) {
+			Slot &s = slots[p_index & (DEQUE_SIZE - 1)];
+			s.group.store(p_task.group, std::memory_order_relaxed);
+			s.range.store(uint64_t(p_task.from) | (uint64_t(p_task.to) << 32), std::memory_order_relaxed);
+		}
+
+		_FORCE_INLINE_ Task _read(int64_t p_index) const {
+			const Slot &s = slots[p_index & (DEQUE_SIZE - 1)];
+			Task t;
+			t.group = s.group.load(std::memory_order_relaxed);
+			uint64_t range = s.range.load(std::memory_order_relaxed);
+			t.from = uint32_t(range & 0xFFFFFFFF);
+			t.to = uint32_t(range >> 32);
+			return t;
+		}
+
+		_FORCE_INLINE_ uint32_t size() const {
+			int64_t b = bottom.load(std::memory_order_relaxed);
+			int64_t t = top.load(std::memory_order_relaxed);
+			return b > t ? uint32_t(b - t) : 0;
+		}
+
+		// Owner only.
+		bool push(const Task &p_task) {
+			int64_t b = bottom.load(std::memory_order_relaxed);
+			int64_t t = top.load(std::memory_order_acquire);
+			if (b - t >= int64_t(DEQUE_SIZE)) {
+				return false;
+			}
+			_write(b, p_task);
+			std::atomic_thread_fence(std::memory_order_release);
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		// Owner only.
+		bool pop(Task &r_task) {
+			int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+			bottom.store(b, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t t = top.load(std::memory_order_relaxed);
+
+			if (t > b) {
+				bottom.store(b + 1, std::memory_order_relaxed);
+				return false;
+			}
+
+			r_task = _read(b);
+			if (t == b) {
+				// Last element, race against thieves.
+				bool won = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				bottom.store(b + 1, std::memory_order_relaxed);
+				return won;
+			}
+			return true;
+		}
+
+		// Any thread.
+		bool steal(Task &r_task) {
+			int64_t t = top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t b = bottom.load(std::memory_order_acquire);
+			if (t >= b) {
+				return false;
+			}
+			r_task = _read(t);
+			return top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+		}
+	};
+
+	struct ThreadData {
+		std::thread thread;
+		Deque deque;
+		WorkStealingPool *pool = nullptr;
+		uint32_t index = 0;
+		uint32_t rng = 0;
+	};
+
+	struct GroupSlot {
+		static constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+		alignas(ALIGNMENT) uint8_t data[128];
+		Group *group = nullptr;
+		std::atomic<bool> used = false;
+	};
+
+	// Tasks submitted from threads that are not part of the pool.
+	struct Injector {
+		std::mutex mutex;
+		Task *tasks = nullptr;
+		uint32_t count = 0;
+		uint32_t capacity = 0;
+		std::atomic<uint32_t> size = 0;
+	};
+
+	ThreadData *threads = nullptr;
+	uint32_t thread_count = 0;
+	GroupSlot *group_slots = nullptr;
+	Injector injector;
+
+	std::atomic<bool> exit = false;
+	std::atomic<uint32_t> sleepers = 0;
+	std::atomic<uint32_t> wake_epoch = 0;
+
+	static inline thread_local ThreadData *current_thread = nullptr;
+
+	_FORCE_INLINE_ ThreadData *_get_current_thread() const {
+		ThreadData *td = current_thread;
+		return (td != nullptr && td->pool == this) ? td : nullptr;
+	}
+
+	_FORCE_INLINE_ void _wake_workers() {
+		// Pairs with the fence in _thread_function(): either the push is visible to a
+		// worker about to park, or that worker's sleepers increment is visible here.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (sleepers.load(std::memory_order_seq_cst) > 0) {
+			wake_epoch.fetch_add(1, std::memory_order_seq_cst);
+			wake_epoch.notify_all();
+		}
+	}
+
+	void _injector_push(const Task &p_task) {
+		std::lock_guard<std::mutex> lock(injector.mutex);
+		if (injector.count == injector.capacity) {
+			injector.capacity = injector.capacity == 0 ? 64 : injector.capacity * 2;
+			injector.tasks = (Task *)memrealloc(injector.tasks, sizeof(Task) * injector.capacity);
+		}
+		injector.tasks[injector.count++] = p_task;
+		injector.size.store(injector.count, std::memory_order_release);
+	}
+
+	bool _injector_pop(Task &r_task) {
+		if (injector.size.load(std::memory_order_acquire) == 0) {
+			return false;
+		}
+		std::lock_guard<std::mutex> lock(injector.mutex);
+		if (injector.count == 0) {
+			return false;
+		}
+		r_task = injector.tasks[--injector.count];
+		injector.size.store(injector.count, std::memory_order_release);
+		return true;
+	}
+
+	// Pushes to the caller's own deque when it is a worker of this pool, to the injector otherwise.
+	_FORCE_INLINE_ bool _push(ThreadData *p_thread, const Task &p_task) {
+		if (p_thread != nullptr) {
+			if (!p_thread->deque.push(p_task)) {
+				return false;
+			}
+		} else {
+			_injector_push(p_task);
+		}
+		_wake_workers();
+		return true;
+	}
+
+	bool _find_task(ThreadData *p_thread, Task &r_task) {
+		if (p_thread != nullptr && p_thread->deque.pop(r_task)) {
+			return true;
+		}
+		if (_injector_pop(r_task)) {
+			return true;
+		}
+
+		// Steal, starting at a pseudo-random victim so thieves spread out.
+		uint32_t start = 0;
+		if (p_thread != nullptr) {
+			p_thread->rng ^= p_thread->rng << 13;
+			p_thread->rng ^= p_thread->rng >> 17;
+			p_thread->rng ^= p_thread->rng << 5;
+			start = p_thread->rng % thread_count;
+		}
+		for (uint32_t i = 0; i < thread_count; i++) {
+			ThreadData &victim = threads[(start + i) % thread_count];
+			if (&victim != p_thread && victim.deque.steal(r_task)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	_FORCE_INLINE_ bool _should_split(ThreadData *p_thread) const {
+		if (p_thread != nullptr) {
+			return p_thread->deque.size() < SPLIT_THRESHOLD;
+		}
+		// External threads feed the injector until every worker could take a piece.
+		return injector.size.load(std::memory_order_relaxed) < thread_count;
+	}
+
+	void _execute(ThreadData *p_thread, const Task &p_task) {
+		Group *group = p_task.group;
+		const uint32_t grain = group->grain;
+		uint32_t from = p_task.from;
+		uint32_t to = p_task.to;
+
+		while (from < to) {
+			while (to - from > grain && _should_split(p_thread)) {
+				uint32_t half = from + (to - from) / 2;
+				Task upper;
+				upper.group = group;
+				upper.from = half;
+				upper.to = to;
+				if (!_push(p_thread, upper)) {
+					break;
+				}
+				to = half;
+			}
+
+			uint32_t chunk_end = MIN(from + grain, to);
+			group->run(group, from, chunk_end);
+			// Once pending reaches zero the group may be gone; only touch it while work remains.
+			group->pending.fetch_sub(chunk_end - from, std::memory_order_acq_rel);
+			from = chunk_end;
+		}
+	}
+
+	// Runs pending tasks until the group completes.
+	void _help_until_done(Group *p_group) {
+		ThreadData *td = _get_current_thread();
+		Task task;
+		while (p_group->pending.load(std::memory_order_acquire) != 0) {
+			if (_find_task(td, task)) {
+				_execute(td, task);
+			} else {
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	static void _thread_function(ThreadData *p_thread) {
+		current_thread = p_thread;
+		WorkStealingPool *pool = p_thread->pool;
+		Task task;
+		uint32_t idle_spins = 0;
+
+		while (!pool->exit.load(std::memory_order_acquire)) {
+			if (pool->_find_task(p_thread, task)) {
+				pool->_execute(p_thread, task);
+				idle_spins = 0;
+				continue;
+			}
+
+			if (++idle_spins < 64) {
+				std::this_thread::yield();
+				continue;
+			}
+
+			// Park until new work is pushed. The epoch is sampled before announcing
+			// the sleep, so a push racing with this check changes it and wait() returns.
+			uint32_t epoch = pool->wake_epoch.load(std::memory_order_seq_cst);
+			pool->sleepers.fetch_add(1, std::memory_order_seq_cst);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (!pool->_has_queued_work() && !pool->exit.load(std::memory_order_seq_cst)) {
+				pool->wake_epoch.wait(epoch, std::memory_order_seq_cst);
+			}
+			pool->sleepers.fetch_sub(1, std::memory_order_seq_cst);
+			idle_spins = 0;
+		}
+
+		current_thread = nullptr;
+	}
+
+	bool _has_queued_work() const {
+		if (injector.size.load(std::memory_order_seq_cst) != 0) {
+			return true;
+		}
+		for (uint32_t i = 0; i < thread_count; i++) {
+			if (threads[i].deque.size() != 0) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	_FORCE_INLINE_ uint32_t _compute_grain(uint32_t p_elements, uint32_t p_grain) const {
+		if (p_grain != 0) {
+			return p_grain;
+		}
+		uint32_t tasks = MAX(1u, (thread_count + 1) * TASKS_PER_THREAD);
+		return MAX(1u, p_elements / tasks);
+	}
+
+	void _start_group(Group *p_group, uint32_t p_elements, uint32_t p_grain) {
+		p_group->grain = _compute_grain(p_elements, p_grain);
+		p_group->pending.store(p_elements, std::memory_order_release);
+
+		Task root;
+		root.group = p_group;
+		root.from = 0;
+		root.to = p_elements;
+
+		ThreadData *td = _get_current_thread();
+		if (!_push(td, root)) {
+			// Local deque is full, run it here.
+			_execute(td, root);
+		}
+	}
+
+	GroupSlot *_get_group_slot(GroupID p_group) const {
+		ERR_FAIL_COND_V(p_group < 0 || p_group >= GroupID(MAX_GROUPS), nullptr);
+		GroupSlot *slot = &group_slots[p_group];
+		ERR_FAIL_COND_V(!slot->used.load(std::memory_order_acquire), nullptr);
+		return slot;
+	}
+
+public:
+	// Starts a group and returns immediately. Must be finished with end_work().
+	template <typename C, typename M, typename U>
+	GroupID begin_work(uint32_t p_elements, C *p_instance, M p_method, U p_userdata, uint32_t p_grain = 0) {
+		ERR_FAIL_NULL_V(threads, INVALID_GROUP_ID); // Never initialized.
+		static_assert(sizeof(Work<C, M, U>) <= sizeof(GroupSlot::data), "Userdata too large for a work group, pass it by pointer.");
+		static_assert(alignof(Work<C, M, U>) <= GroupSlot::ALIGNMENT, "Userdata is over-aligned for a work group, pass it by pointer.");
+
+		for (uint32_t i = 0; i < MAX_GROUPS; i++) {
+			bool expected = false;
+			if (!group_slots[i].used.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+				continue;
+			}
+
+			Work<C, M, U> *w = new (group_slots[i].data) Work<C, M, U>(p_instance, p_method, p_userdata);
+			group_slots[i].group = w;
+			if (p_elements == 0) {
+				w->pending.store(0, std::memory_order_release);
+			} else {
+				_start_group(w, p_elements, p_grain);
+			}
+			return GroupID(i);
+		}
+
+		ERR_FAIL_V_MSG(INVALID_GROUP_ID, "Too many work groups in flight.");
+	}
+
+	bool is_done(GroupID p_group) const {
+		GroupSlot *slot = _get_group_slot(p_group);
+		ERR_FAIL_NULL_V(slot, true);
+		return slot->group->pending.load(std::memory_order_acquire) == 0;
+	}
+
+	// Waits for the group, running pending tasks meanwhile, and releases it.
+	void end_work(GroupID p_group) {
+		GroupSlot *slot = _get_group_slot(p_group);
+		ERR_FAIL_NULL(slot);
+
+		Group *group = slot->group;
+		_help_until_done(group);
+		group->destroy(group);
+		slot->group = nullptr;
+		slot->used.store(false, std::memory_order_release);
+	}
+
+	// Runs a group to completion. Can be called from inside a work function.
+	template <typename C, typename M, typename U>
+	void do_work(uint32_t p_elements, C *p_instance, M p_method, U p_userdata, uint32_t p_grain = 0) {
+		switch (p_elements) {
+			case 0:
+				// Nothing to do, so do nothing.
+				break;
+			case 1:
+				// Not worth waking anyone for a single job.
+				(p_instance->*p_method)(0, p_userdata);
+				break;
+			default: {
+				ERR_FAIL_NULL(threads); // Never initialized.
+				Work<C, M, U> w(p_instance, p_method, p_userdata);
+				_start_group(&w, p_elements, p_grain);
+				_help_until_done(&w);
+			}
+		}
+	}
+
+	_FORCE_INLINE_ int get_thread_count() const { return thread_count; }
+
+	void init(int p_thread_count = -1) {
+		ERR_FAIL_COND(threads != nullptr);
+		if (p_thread_count < 0) {
+			p_thread_count = OS::get_singleton()->get_processor_count();
+		}
+		ERR_FAIL_COND(p_thread_count == 0);
+
+		thread_count = p_thread_count;
+		exit.store(false);
+		threads = new ThreadData[thread_count];
+		group_slots = new GroupSlot[MAX_GROUPS];
+
+		for (uint32_t i = 0; i < thread_count; i++) {
+			threads[i].pool = this;
+			threads[i].index = i;
+			threads[i].rng = 0x9E3779B9u * (i + 1);
+		}
+		for (uint32_t i = 0; i < thread_count; i++) {
+			threads[i].thread = std::thread(&WorkStealingPool::_thread_function, &threads[i]);
+		}
+	}
+
+	void finish() {
+		if (threads == nullptr) {
+			return;
+		}
+
+		exit.store(true, std::memory_order_seq_cst);
+		wake_epoch.fetch_add(1, std::memory_order_seq_cst);
+		wake_epoch.notify_all();
+
+		for (uint32_t i = 0; i < thread_count; i++) {
+			threads[i].thread.join();
+		}
+
+		for (uint32_t i = 0; i < MAX_GROUPS; i++) {
+			ERR_CONTINUE_MSG(group_slots[i].used.load(), "Work group was started but never finished with end_work().");
+		}
+
+		delete[] (threads);
+		threads = nullptr;
+		delete[] (group_slots);
+		group_slots = nullptr;
+		thread_count = 0;
+
+		if (injector.tasks) {
+			memfree(injector.tasks);
+			injector.tasks = nullptr;
+			injector.count = 0;
+			injector.capacity = 0;
+		}
+	}
+
+	~WorkStealingPool() {
+		finish();
+	}
+};
+
+} // namespace godot
+
+#endif // GODOT_WORK_STEALING_POOL_HPP
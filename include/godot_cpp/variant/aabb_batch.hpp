@@ -0,0 +1,89 @@
+/**************************************************************************/
+/*  aabb_batch.hpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_AABB_BATCH_HPP
+#define GODOT_AABB_BATCH_HPP
+
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/aabb.hpp>
+
+namespace godot {
+
+struct Projection;
+struct Transform3D;
+
+/**
+ * Structure-of-arrays storage for many AABBs, tested all at once with SIMD.
+ *
+ * Boxes are kept as separate min/max arrays per axis. Every query writes one
+ * bit per box to r_mask (bit i % 64 of word i / 64), which must hold
+ * get_mask_size() words; mask_to_indices() compacts a mask into a list of box
+ * indices. Each query gives the same answer as the AABB method of the same
+ * name, called on every box.
+ */
+
+class AABBBatch {
+	// Padded to a whole number of SIMD registers, the padding is zero and masked out of the results.
+	LocalVector<real_t> min_x, min_y, min_z;
+	LocalVector<real_t> max_x, max_y, max_z;
+	uint32_t count = 0;
+
+	void _resize_storage(uint32_t p_count);
+	template <typename F>
+	void _write_mask(uint64_t *r_mask, F p_test) const;
+
+public:
+	_FORCE_INLINE_ uint32_t size() const { return count; }
+	_FORCE_INLINE_ bool is_empty() const { return count == 0; }
+	_FORCE_INLINE_ uint32_t get_mask_size() const { return (count + 63) / 64; }
+
+	void clear();
+	void reserve(uint32_t p_count);
+
+	uint32_t push_back(const AABB &p_aabb);
+	void set(uint32_t p_index, const AABB &p_aabb);
+	AABB get(uint32_t p_index) const;
+	// Moves the last box into p_index.
+	void remove_at_unordered(uint32_t p_index);
+
+	void intersects(const AABB &p_aabb, uint64_t *r_mask) const;
+	void intersects_ray(const Vector3 &p_from, const Vector3 &p_dir, uint64_t *r_mask) const;
+	void intersects_convex_shape(const Plane *p_planes, int p_plane_count, const Vector3 *p_points, int p_point_count, uint64_t *r_mask) const;
+	void inside_convex_shape(const Plane *p_planes, int p_plane_count, uint64_t *r_mask) const;
+	// Frustum culling, intersects_convex_shape() with the planes and corners of the view frustum.
+	void cull(const Projection &p_projection, const Transform3D &p_transform, uint64_t *r_mask) const;
+
+	// Writes the index of every set bit in p_mask to r_indices, which must hold p_count indices. Returns how many were written.
+	static uint32_t mask_to_indices(const uint64_t *p_mask, uint32_t p_count, uint32_t *r_indices);
+};
+
+} // namespace godot
+
+#endif // GODOT_AABB_BATCH_HPP
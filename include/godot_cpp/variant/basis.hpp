@@ -149,6 +149,9 @@ struct _NO_DISCARD_ Basis {
 
 	_FORCE_INLINE_ Vector3 xform(const Vector3 &p_vector) const;
 	_FORCE_INLINE_ Vector3 xform_inv(const Vector3 &p_vector) const;
+	// Batch versions of xform() and xform_inv() using SIMD. r_dst may be p_src, but the arrays must not otherwise overlap.
+	void xform_batch(const Vector3 *p_src, Vector3 *r_dst, size_t p_count) const;
+	void xform_inv_batch(const Vector3 *p_src, Vector3 *r_dst, size_t p_count) const;
 	_FORCE_INLINE_ void operator*=(const Basis &p_matrix);
 	_FORCE_INLINE_ Basis operator*(const Basis &p_matrix) const;
 	_FORCE_INLINE_ void operator+=(const Basis &p_matrix);
@@ -241,6 +244,8 @@ struct _NO_DISCARD_ Basis {
 	static Basis looking_at(const Vector3 &p_target, const Vector3 &p_up = Vector3(0, 1, 0), bool p_use_model_front = false);
 
 	Basis(const Quaternion &p_quaternion) { set_quaternion(p_quaternion); }
+	// Batch version of Basis(const Quaternion &) using SIMD.
+	static void from_quaternion_batch(const Quaternion *p_src, Basis *r_dst, size_t p_count);
 	Basis(const Quaternion &p_quaternion, const Vector3 &p_scale) { set_quaternion_scale(p_quaternion, p_scale); }
 
 	Basis(const Vector3 &p_axis, real_t p_angle) { set_axis_angle(p_axis, p_angle); }
@@ -410,6 +415,8 @@ public:
 	GODOT_PROPERTY_WRAPPED_FUNCTION(is_finite, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(xform, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_inv, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_batch, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_inv_batch, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(is_orthogonal, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(is_diagonal, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(is_rotation, Self);
@@ -432,6 +439,7 @@ public:
 #endif
 	GODOT_PROPERTY_WRAPPED_FUNCTION(diagonalize, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(looking_at, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(from_quaternion_batch, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(from_scale, Self);
 };
 
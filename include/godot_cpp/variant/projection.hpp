@@ -125,6 +125,14 @@ struct _NO_DISCARD_ Projection {
 	Vector4 xform(const Vector4 &p_vec4) const;
 	Vector4 xform_inv(const Vector4 &p_vec4) const;
 
+	// Batch versions of xform() and operator*() using SIMD, r_dst may be p_src. The Vector3 version includes the
+	// perspective divide. mul_batch() computes *this * p_src[i], treating each Transform3D like Projection(Transform3D).
+	// Any alignment works, but arrays from Memory::alloc_aligned_static(p_bytes, simd::ALIGNMENT) load faster.
+	void xform_batch(const Vector3 *p_src, Vector3 *r_dst, size_t p_count) const;
+	void xform_batch(const Vector4 *p_src, Vector4 *r_dst, size_t p_count) const;
+	void mul_batch(const Projection *p_src, Projection *r_dst, size_t p_count) const;
+	void mul_batch(const Transform3D *p_src, Projection *r_dst, size_t p_count) const;
+
 	operator String() const;
 
 	void scale_translate_to_fit(const AABB &p_aabb);
@@ -255,6 +263,8 @@ public:
 	template<typename... Args> requires (getsetable<Self>) auto xform(Args... args) { auto temp = get(); auto ret = temp.xform(std::forward<Args>(args)...); set(temp); return ret; }
 	template<typename... Args> requires (!getsetable<Self> && getable<Self>) auto xform(Args... args) const { const auto temp = get(); auto ret = temp.xform(std::forward<Args>(args)...); return ret; }
 	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_inv, Self);
+	template<typename... Args> requires (getable<Self>) void xform_batch(Args... args) const { const auto temp = get(); temp.xform_batch(std::forward<Args>(args)...); }
+	template<typename... Args> requires (getable<Self>) void mul_batch(Args... args) const { const auto temp = get(); temp.mul_batch(std::forward<Args>(args)...); }
 	GODOT_PROPERTY_WRAPPED_FUNCTION(scale_translate_to_fit, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(add_jitter_offset, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(make_scale, Self);
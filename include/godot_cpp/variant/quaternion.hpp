@@ -61,6 +61,8 @@ struct _NO_DISCARD_ Quaternion {
 	real_t length() const;
 	void normalize();
 	Quaternion normalized() const;
+	void normalize_fast();
+	Quaternion normalized_fast() const;
 	bool is_normalized() const;
 	Quaternion inverse() const;
 	Quaternion log() const;
@@ -76,6 +78,13 @@ struct _NO_DISCARD_ Quaternion {
 	Quaternion spherical_cubic_interpolate(const Quaternion &p_b, const Quaternion &p_pre_a, const Quaternion &p_post_b, real_t p_weight) const;
 	Quaternion spherical_cubic_interpolate_in_time(const Quaternion &p_b, const Quaternion &p_pre_a, const Quaternion &p_post_b, real_t p_weight, real_t p_b_t, real_t p_pre_a_t, real_t p_post_b_t) const;
 
+	// Batch versions of slerp() using SIMD, for many pairs at once with one weight per pair. r_dst may be p_from or p_to.
+	// With p_approximate, the weight is corrected with a polynomial and used for nlerp instead of evaluating acos() and sin(),
+	// which keeps the result within 0.05 degrees of slerp().
+	static void slerp_batch(const Quaternion *p_from, const Quaternion *p_to, const real_t *p_weights, Quaternion *r_dst, size_t p_count, bool p_approximate = false);
+	// Normalized linear interpolation along the shortest path, faster than slerp_batch() but not at constant angular speed.
+	static void nlerp_batch(const Quaternion *p_from, const Quaternion *p_to, const real_t *p_weights, Quaternion *r_dst, size_t p_count);
+
 	Vector3 get_axis() const;
 	Math::Radian get_angle() const;
 
@@ -250,6 +259,8 @@ public:
 	GODOT_PROPERTY_WRAPPED_FUNCTION(length, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize_fast, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized_fast, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(is_normalized, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(inverse, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(log, Self);
@@ -262,6 +273,8 @@ public:
 	GODOT_PROPERTY_WRAPPED_FUNCTION(slerpni, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(spherical_cubic_interpolate, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(spherical_cubic_interpolate_in_time, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(slerp_batch, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(nlerp_batch, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(get_axis, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(get_angle, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(get_axis_angle, Self);
@@ -0,0 +1,91 @@
+/**************************************************************************/
+/*  string_name_literal.hpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_STRING_NAME_LITERAL_HPP
+#define GODOT_STRING_NAME_LITERAL_HPP
+
+#include <godot_cpp/variant/string_name.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace godot {
+
+namespace internal {
+
+// A string literal usable as a template argument. Each distinct literal names
+// a distinct template instance, shared by every translation unit using it.
+template <size_t N>
+struct StringNameLiteral {
+	char data[N];
+	// Same value as StringName::hash() returns for this (Latin-1) string.
+	uint32_t hash = 5381;
+
+	consteval StringNameLiteral(const char (&p_str)[N]) {
+		for (size_t i = 0; i < N; i++) {
+			data[i] = p_str[i];
+		}
+		for (size_t i = 0; i + 1 < N; i++) {
+			hash = ((hash << 5) + hash) + uint8_t(p_str[i]);
+		}
+	}
+};
+
+template <StringNameLiteral L>
+_FORCE_INLINE_ const StringName &sname() {
+	// Interned on first use, as a static name so the engine never frees it.
+	static const StringName name(L.data, true);
+	return name;
+}
+
+} // namespace internal
+
+// Returns a StringName that is interned once per process, on first use:
+//
+//     obj->call(SNAME("queue_free"));
+//     obj->call("queue_free"_sn);
+//
+// Only for string literals, and not before the core initialization level.
+#define SNAME(m_arg) (::godot::internal::sname<m_arg>())
+
+template <internal::StringNameLiteral L>
+_FORCE_INLINE_ const StringName &operator""_sn() {
+	return internal::sname<L>();
+}
+
+// Hash of a literal as computed by StringName::hash(), usable in switch cases.
+template <internal::StringNameLiteral L>
+constexpr uint32_t sname_hash() {
+	return L.hash;
+}
+
+} // namespace godot
+
+#endif // GODOT_STRING_NAME_LITERAL_HPP
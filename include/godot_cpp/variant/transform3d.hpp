@@ -95,6 +95,12 @@ struct _NO_DISCARD_ Transform3D {
 	_FORCE_INLINE_ AABB xform_inv(const AABB &p_aabb) const;
 	_FORCE_INLINE_ PackedVector3Array xform_inv(const PackedVector3Array &p_array) const;
 
+	// Batch versions of xform() and xform_inv() using SIMD. r_dst may be p_src, but the arrays must not otherwise overlap.
+	void xform_batch(const Vector3 *p_src, Vector3 *r_dst, size_t p_count) const;
+	void xform_inv_batch(const Vector3 *p_src, Vector3 *r_dst, size_t p_count) const;
+	// Bounds of the transformed points, without storing them.
+	AABB xform_bounds(const Vector3 *p_points, size_t p_count) const;
+
 	// Safe with non-uniform scaling (uses affine_inverse).
 	_FORCE_INLINE_ Plane xform(const Plane &p_plane) const;
 	_FORCE_INLINE_ Plane xform_inv(const Plane &p_plane) const;
@@ -217,12 +223,7 @@ PackedVector3Array Transform3D::xform(const PackedVector3Array &p_array) const {
 	PackedVector3Array array;
 	array.resize(p_array.size());
 
-	const Vector3 *r = p_array.ptr();
-	Vector3 *w = array.ptrw();
-
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform(r[i]);
-	}
+	xform_batch(p_array.ptr(), array.ptrw(), p_array.size());
 	return array;
 }
 
@@ -230,12 +231,7 @@ PackedVector3Array Transform3D::xform_inv(const PackedVector3Array &p_array) con
 	PackedVector3Array array;
 	array.resize(p_array.size());
 
-	const Vector3 *r = p_array.ptr();
-	Vector3 *w = array.ptrw();
-
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform_inv(r[i]);
-	}
+	xform_inv_batch(p_array.ptr(), array.ptrw(), p_array.size());
 	return array;
 }
 
@@ -310,6 +306,9 @@ public:
 	template<typename... Args> requires (!getsetable<Self> && getable<Self>) auto xform(Args... args) const { const auto temp = get(); auto ret = temp.xform(std::forward<Args>(args)...); return ret; }
 	template<typename... Args> requires (getsetable<Self> ) auto xform_inv(Args... args) { auto temp = get(); auto ret = temp.xform_inv(std::forward<Args>(args)...); set(temp); return ret; }
 	template<typename... Args> requires (!getsetable<Self> && getable<Self>) auto xform_inv(Args... args) const { const auto temp = get(); auto ret = temp.xform_inv(std::forward<Args>(args)...); return ret; }
+	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_batch, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_inv_batch, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_bounds, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_fast, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(xform_inv_fast, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(interpolate_with, Self);
@@ -32,6 +32,7 @@
 #define GODOT_VARIANT_HPP
 
 #include <godot_cpp/core/defs.hpp>
+#include <godot_cpp/core/memory.hpp>
 #include <godot_cpp/classes/property_wrappers.hpp>
 
 #include <godot_cpp/variant/builtin_types.hpp>
@@ -40,6 +41,8 @@
 #include <gdextension_interface.h>
 
 #include <array>
+#include <cstring>
+#include <type_traits>
 
 namespace godot {
 
@@ -145,6 +148,90 @@ private:
 	static GDExtensionVariantFromTypeConstructorFunc from_type_constructor[VARIANT_MAX];
 	static GDExtensionTypeFromVariantConstructorFunc to_type_constructor[VARIANT_MAX];
 
+	// The engine stores the type as a 32-bit integer, followed by the value at
+	// DATA_OFFSET. Types that don't need deinit are stored inline and can be
+	// encoded, copied and destroyed without calling into the engine, once
+	// init_bindings() has checked this layout against the engine's own.
+	static constexpr size_t DATA_OFFSET = 8;
+	static bool inline_pod_enabled;
+	static const bool needs_deinit[VARIANT_MAX];
+
+	struct NoInit {};
+	explicit Variant(NoInit) {}
+
+	template <typename T>
+	static constexpr Type _get_pod_type() {
+		if constexpr (std::is_same_v<T, bool>) {
+			return BOOL;
+		} else if constexpr (std::is_integral_v<T>) {
+			return INT;
+		} else if constexpr (std::is_floating_point_v<T>) {
+			return FLOAT;
+		} else if constexpr (std::is_same_v<T, Vector2>) {
+			return VECTOR2;
+		} else if constexpr (std::is_same_v<T, Vector2i>) {
+			return VECTOR2I;
+		} else if constexpr (std::is_same_v<T, Rect2>) {
+			return RECT2;
+		} else if constexpr (std::is_same_v<T, Rect2i>) {
+			return RECT2I;
+		} else if constexpr (std::is_same_v<T, Vector3>) {
+			return VECTOR3;
+		} else if constexpr (std::is_same_v<T, Vector3i>) {
+			return VECTOR3I;
+		} else if constexpr (std::is_same_v<T, Vector4>) {
+			return VECTOR4;
+		} else if constexpr (std::is_same_v<T, Vector4i>) {
+			return VECTOR4I;
+		} else if constexpr (std::is_same_v<T, Plane>) {
+			return PLANE;
+		} else if constexpr (std::is_same_v<T, Quaternion>) {
+			return QUATERNION;
+		} else if constexpr (std::is_same_v<T, Color>) {
+			return COLOR;
+		} else if constexpr (std::is_same_v<T, godot::RID>) {
+			return RID;
+		} else {
+			return VARIANT_MAX;
+		}
+	}
+
+	static _FORCE_INLINE_ void _encode_pod(uint8_t *r_dest, Type p_type, const void *p_value, size_t p_size) {
+		int32_t type = p_type;
+		memcpy(r_dest, &type, sizeof(type));
+		memcpy(r_dest + DATA_OFFSET, p_value, p_size);
+	}
+
+	// Expects opaque to be zeroed, as it is on construction.
+	template <typename T>
+	_FORCE_INLINE_ void _init_pod(const T &p_value) {
+		constexpr Type type = _get_pod_type<T>();
+		static_assert(type != VARIANT_MAX);
+		if constexpr (type == BOOL) {
+			uint8_t value = p_value ? 1 : 0;
+			_encode_pod(opaque, type, &value, sizeof(value));
+		} else if constexpr (type == INT) {
+			int64_t value = p_value;
+			_encode_pod(opaque, type, &value, sizeof(value));
+		} else if constexpr (type == FLOAT) {
+			double value = p_value;
+			_encode_pod(opaque, type, &value, sizeof(value));
+		} else if constexpr (type == RID) {
+			_encode_pod(opaque, type, p_value._native_ptr(), sizeof(uint64_t));
+		} else {
+			static_assert(std::is_standard_layout_v<T> && std::is_trivially_destructible_v<T> && sizeof(T) <= GODOT_CPP_VARIANT_SIZE - DATA_OFFSET);
+			_encode_pod(opaque, type, &p_value, sizeof(T));
+		}
+	}
+
+	_FORCE_INLINE_ Type _get_type_inline() const {
+		int32_t type;
+		memcpy(&type, opaque, sizeof(type));
+		return Type(type);
+	}
+
+	static bool _check_pod_layout(Type p_type, const void *p_value, size_t p_size);
+
 public:
 	_FORCE_INLINE_ GDExtensionVariantPtr _native_ptr() const { return const_cast<uint8_t(*)[GODOT_CPP_VARIANT_SIZE]>(&opaque); }
 	Variant();
@@ -337,6 +424,26 @@ public:
 	static bool can_convert_strict(Variant::Type from, Variant::Type to);
 
 	void clear();
+
+	// Constructs p_count Variants from p_values into uninitialized memory at
+	// r_dest. Types stored inline are encoded without calling into the engine.
+	template <typename T>
+	static void construct_batch(Variant *r_dest, const T *p_values, size_t p_count) {
+		if constexpr (_get_pod_type<T>() != VARIANT_MAX) {
+			if (likely(inline_pod_enabled)) {
+				for (size_t i = 0; i < p_count; i++) {
+					memnew_placement(&r_dest[i], Variant(NoInit{}))->_init_pod(p_values[i]);
+				}
+				return;
+			}
+		}
+		for (size_t i = 0; i < p_count; i++) {
+			memnew_placement(&r_dest[i], Variant(p_values[i]));
+		}
+	}
+
+	// Destroys p_count Variants at p_variants, leaving the memory uninitialized.
+	static void destroy_batch(Variant *p_variants, size_t p_count);
 };
 
 struct VariantHasher {
@@ -82,6 +82,8 @@ struct _NO_DISCARD_ Vector2 {
 
 	void normalize();
 	Vector2 normalized() const;
+	void normalize_fast();
+	Vector2 normalized_fast() const;
 	bool is_normalized() const;
 
 	real_t length() const;
@@ -346,6 +348,8 @@ public:
 	GODOT_PROPERTY_WRAPPED_FUNCTION(max_axis_index, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize_fast, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized_fast, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(is_normalized, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(length, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(length_squared, Self);
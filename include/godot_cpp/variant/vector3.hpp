@@ -100,6 +100,9 @@ struct _NO_DISCARD_ Vector3 {
 
 	_FORCE_INLINE_ void normalize();
 	_FORCE_INLINE_ Vector3 normalized() const;
+	// Multiplies by Math::fast::rsqrt() of the squared length instead of dividing by the length.
+	void normalize_fast();
+	Vector3 normalized_fast() const;
 	_FORCE_INLINE_ bool is_normalized() const;
 	_FORCE_INLINE_ Vector3 inverse() const;
 	Vector3 limit_length(const real_t p_len = 1.0) const;
@@ -568,6 +571,8 @@ public:
 	GODOT_PROPERTY_WRAPPED_FUNCTION(length_squared, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize_fast, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized_fast, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(is_normalized, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(inverse, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(limit_length, Self);
@@ -95,6 +95,8 @@ struct _NO_DISCARD_ Vector4 {
 	real_t length() const;
 	void normalize();
 	Vector4 normalized() const;
+	void normalize_fast();
+	Vector4 normalized_fast() const;
 	bool is_normalized() const;
 
 	real_t distance_to(const Vector4 &p_to) const;
@@ -345,6 +347,8 @@ public:
 	GODOT_PROPERTY_WRAPPED_FUNCTION(length, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalize_fast, Self);
+	GODOT_PROPERTY_WRAPPED_FUNCTION(normalized_fast, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(is_normalized, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(distance_to, Self);
 	GODOT_PROPERTY_WRAPPED_FUNCTION(distance_squared_to, Self);
@@ -0,0 +1,123 @@
+/**************************************************************************/
+/*  vector_stream.hpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GODOT_VECTOR_STREAM_HPP
+#define GODOT_VECTOR_STREAM_HPP
+
+#include <godot_cpp/templates/span.hpp>
+#include <godot_cpp/variant/aabb.hpp>
+#include <godot_cpp/variant/rect2.hpp>
+#include <godot_cpp/variant/vector2.hpp>
+#include <godot_cpp/variant/vector3.hpp>
+#include <godot_cpp/variant/vector4.hpp>
+
+namespace godot {
+
+/**
+ * Bulk Vector2/Vector3/Vector4 math over spans, vectorized with simd::RealV.
+ *
+ * Packed arrays take part through view() and mut_view(), for example
+ * simd::normalize(points.view(), points.mut_view()). Inputs and r_dst must all
+ * have the same size, otherwise nothing is written. r_dst may be one of the
+ * inputs, but must not partially overlap them.
+ *
+ * Each function evaluates the same expression as the Vector method of the same
+ * name, so results match per-element calls exactly, except fma() which is fused
+ * when the target has FMA instructions.
+ */
+
+namespace simd {
+
+// r_dst[i] = p_a[i] + p_b[i]
+void add(Span<const Vector2> p_a, Span<const Vector2> p_b, Span<Vector2> r_dst);
+void add(Span<const Vector3> p_a, Span<const Vector3> p_b, Span<Vector3> r_dst);
+void add(Span<const Vector4> p_a, Span<const Vector4> p_b, Span<Vector4> r_dst);
+
+// r_dst[i] = p_a[i] - p_b[i]
+void sub(Span<const Vector2> p_a, Span<const Vector2> p_b, Span<Vector2> r_dst);
+void sub(Span<const Vector3> p_a, Span<const Vector3> p_b, Span<Vector3> r_dst);
+void sub(Span<const Vector4> p_a, Span<const Vector4> p_b, Span<Vector4> r_dst);
+
+// r_dst[i] = p_a[i] * p_b[i]
+void mul(Span<const Vector2> p_a, Span<const Vector2> p_b, Span<Vector2> r_dst);
+void mul(Span<const Vector3> p_a, Span<const Vector3> p_b, Span<Vector3> r_dst);
+void mul(Span<const Vector4> p_a, Span<const Vector4> p_b, Span<Vector4> r_dst);
+
+// r_dst[i] = p_a[i] * p_scalar
+void mul(Span<const Vector2> p_a, real_t p_scalar, Span<Vector2> r_dst);
+void mul(Span<const Vector3> p_a, real_t p_scalar, Span<Vector3> r_dst);
+void mul(Span<const Vector4> p_a, real_t p_scalar, Span<Vector4> r_dst);
+
+// r_dst[i] = p_a[i] * p_b[i] + p_c[i]
+void fma(Span<const Vector2> p_a, Span<const Vector2> p_b, Span<const Vector2> p_c, Span<Vector2> r_dst);
+void fma(Span<const Vector3> p_a, Span<const Vector3> p_b, Span<const Vector3> p_c, Span<Vector3> r_dst);
+void fma(Span<const Vector4> p_a, Span<const Vector4> p_b, Span<const Vector4> p_c, Span<Vector4> r_dst);
+
+// r_dst[i] = p_from[i].lerp(p_to[i], p_weight)
+void lerp(Span<const Vector2> p_from, Span<const Vector2> p_to, real_t p_weight, Span<Vector2> r_dst);
+void lerp(Span<const Vector3> p_from, Span<const Vector3> p_to, real_t p_weight, Span<Vector3> r_dst);
+void lerp(Span<const Vector4> p_from, Span<const Vector4> p_to, real_t p_weight, Span<Vector4> r_dst);
+
+// r_dst[i] = p_a[i].dot(p_b[i])
+void dot(Span<const Vector2> p_a, Span<const Vector2> p_b, Span<real_t> r_dst);
+void dot(Span<const Vector3> p_a, Span<const Vector3> p_b, Span<real_t> r_dst);
+void dot(Span<const Vector4> p_a, Span<const Vector4> p_b, Span<real_t> r_dst);
+
+// r_dst[i] = p_a[i].cross(p_b[i])
+void cross(Span<const Vector2> p_a, Span<const Vector2> p_b, Span<real_t> r_dst);
+void cross(Span<const Vector3> p_a, Span<const Vector3> p_b, Span<Vector3> r_dst);
+
+// r_dst[i] = p_a[i].length()
+void length(Span<const Vector2> p_a, Span<real_t> r_dst);
+void length(Span<const Vector3> p_a, Span<real_t> r_dst);
+void length(Span<const Vector4> p_a, Span<real_t> r_dst);
+
+// r_dst[i] = p_a[i].normalized()
+void normalize(Span<const Vector2> p_a, Span<Vector2> r_dst);
+void normalize(Span<const Vector3> p_a, Span<Vector3> r_dst);
+void normalize(Span<const Vector4> p_a, Span<Vector4> r_dst);
+
+// Per-component minimum and maximum over the whole span, zero when it is empty.
+Vector2 reduce_min(Span<const Vector2> p_a);
+Vector3 reduce_min(Span<const Vector3> p_a);
+Vector4 reduce_min(Span<const Vector4> p_a);
+Vector2 reduce_max(Span<const Vector2> p_a);
+Vector3 reduce_max(Span<const Vector3> p_a);
+Vector4 reduce_max(Span<const Vector4> p_a);
+
+// The smallest box enclosing every point, empty when there are none.
+Rect2 bounds(Span<const Vector2> p_points);
+AABB bounds(Span<const Vector3> p_points);
+
+} // namespace simd
+
+} // namespace godot
+
+#endif // GODOT_VECTOR_STREAM_HPP
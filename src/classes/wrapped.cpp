@@ -28,6 +28,7 @@
 /* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
 /**************************************************************************/
 
+#include <chrono>
 #include <vector>
 
 #include <godot_cpp/classes/wrapped.hpp>
@@ -38,6 +39,8 @@
 
 #include <godot_cpp/core/class_db.hpp>
 
+#include <godot_cpp/variant/utility_functions.hpp>
+
 namespace godot {
 
 #ifdef _GODOT_CPP_AVOID_THREAD_LOCAL
@@ -146,6 +149,65 @@ void register_engine_classes() {
 	engine_class_registration_callbacks.clear();
 }
 
+std::vector<EngineMethodBindTable *> &get_engine_method_bind_tables() {
+	static std::vector<EngineMethodBindTable *> engine_method_bind_tables;
+	return engine_method_bind_tables;
+}
+
+EngineMethodBindTable::EngineMethodBindTable(const char *p_class_name, GDExtensionInitializationLevel p_level, uint32_t p_count, const char *const *p_method_names, const GDExtensionInt *p_method_hashes, std::atomic<GDExtensionMethodBindPtr> *p_method_binds) :
+		class_name(p_class_name),
+		level(p_level),
+		count(p_count),
+		method_names(p_method_names),
+		method_hashes(p_method_hashes),
+		method_binds(p_method_binds) {
+	get_engine_method_bind_tables().push_back(this);
+}
+
+GDExtensionMethodBindPtr EngineMethodBindTable::resolve(uint32_t p_index) {
+	StringName class_sn(class_name);
+	StringName method_sn(method_names[p_index]);
+	GDExtensionMethodBindPtr method_bind = gdextension_interface_classdb_get_method_bind(class_sn._native_ptr(), method_sn._native_ptr(), method_hashes[p_index]);
+	method_binds[p_index].store(method_bind, std::memory_order_relaxed);
+	return method_bind;
+}
+
+void resolve_engine_method_binds(GDExtensionInitializationLevel p_level) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	int64_t class_count = 0;
+	int64_t method_count = 0;
+
+	for (EngineMethodBindTable *table : get_engine_method_bind_tables()) {
+		if (table->level != p_level) {
+			continue;
+		}
+		for (uint32_t i = 0; i < table->count; i++) {
+			if (table->method_binds[i].load(std::memory_order_relaxed) != nullptr) {
+				continue; // Already resolved by an early call.
+			}
+			table->resolve(i);
+		}
+		class_count++;
+		method_count += table->count;
+	}
+
+	if (class_count > 0) {
+		int64_t usec = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+		UtilityFunctions::print_verbose(vformat("godot-cpp: Resolved %d method binds of %d engine classes in %d usec.", method_count, class_count, usec));
+	}
+}
+
+void clear_engine_method_binds(GDExtensionInitializationLevel p_level) {
+	for (EngineMethodBindTable *table : get_engine_method_bind_tables()) {
+		if (table->level != p_level) {
+			continue;
+		}
+		for (uint32_t i = 0; i < table->count; i++) {
+			table->method_binds[i].store(nullptr, std::memory_order_relaxed);
+		}
+	}
+}
+
 } // namespace internal
 
 } // namespace godot
@@ -32,11 +32,13 @@
 
 #include <godot_cpp/core/error_macros.hpp>
 #include <godot_cpp/godot.hpp>
+#include <godot_cpp/templates/arena.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
 #include <godot_cpp/core/memory.hpp>
 
 #include <algorithm>
+#include <atomic>
 
 namespace godot {
 
@@ -47,6 +49,9 @@ std::unordered_map<StringName, Object *> ClassDB::engine_singletons;
 std::mutex ClassDB::engine_singletons_mutex;
 GDExtensionInitializationLevel ClassDB::current_level = GDEXTENSION_INITIALIZATION_CORE;
 
+// Scratch memory for building the data passed to Godot when registering methods.
+static Arena registration_arena(16 * 1024);
+
 MethodDefinition D_METHOD(StringName p_name) {
 	return MethodDefinition(p_name);
 }
@@ -186,41 +191,43 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, const M
 }
 
 void ClassDB::bind_method_godot(const StringName &p_class_name, MethodBind *p_method) {
-	std::vector<GDExtensionVariantPtr> def_args;
+	// Everything below only needs to live until Godot has copied it.
+	const Arena::Mark mark = registration_arena.get_mark();
+
 	const std::vector<Variant> &def_args_val = p_method->get_default_arguments();
-	def_args.resize(def_args_val.size());
+	GDExtensionVariantPtr *def_args = registration_arena.alloc_array<GDExtensionVariantPtr>(def_args_val.size());
 	for (size_t i = 0; i < def_args_val.size(); i++) {
 		def_args[i] = (GDExtensionVariantPtr)&def_args_val[i];
 	}
 
-	std::vector<PropertyInfo> return_value_and_arguments_info = p_method->get_arguments_info_list();
-	std::vector<GDExtensionClassMethodArgumentMetadata> return_value_and_arguments_metadata = p_method->get_arguments_metadata_list();
-
-	std::vector<GDExtensionPropertyInfo> return_value_and_arguments_gdextension_info;
-	return_value_and_arguments_gdextension_info.reserve(return_value_and_arguments_info.size());
-	for (std::vector<PropertyInfo>::iterator it = return_value_and_arguments_info.begin(); it != return_value_and_arguments_info.end(); it++) {
-		return_value_and_arguments_gdextension_info.push_back(
-				GDExtensionPropertyInfo{
-						static_cast<GDExtensionVariantType>(it->type), // GDExtensionVariantType type;
-						it->name._native_ptr(), // GDExtensionStringNamePtr name;
-						it->class_name._native_ptr(), // GDExtensionStringNamePtr class_name;
-						it->hint, // uint32_t hint;
-						it->hint_string._native_ptr(), // GDExtensionStringPtr hint_string;
-						it->usage, // uint32_t usage;
-				});
+	// First element is the return value.
+	const int info_count = p_method->get_argument_count() + 1;
+	PropertyInfo *return_value_and_arguments_info = registration_arena.alloc_array<PropertyInfo>(info_count);
+	GDExtensionPropertyInfo *return_value_and_arguments_gdextension_info = registration_arena.alloc_array<GDExtensionPropertyInfo>(info_count);
+	for (int i = 0; i < info_count; i++) {
+		PropertyInfo *it = memnew_placement(&return_value_and_arguments_info[i], PropertyInfo(p_method->get_argument_info(i - 1)));
+		return_value_and_arguments_gdextension_info[i] = GDExtensionPropertyInfo{
+			static_cast<GDExtensionVariantType>(it->type), // GDExtensionVariantType type;
+			it->name._native_ptr(), // GDExtensionStringNamePtr name;
+			it->class_name._native_ptr(), // GDExtensionStringNamePtr class_name;
+			it->hint, // uint32_t hint;
+			it->hint_string._native_ptr(), // GDExtensionStringPtr hint_string;
+			it->usage, // uint32_t usage;
+		};
 	}
+	const GDExtensionClassMethodArgumentMetadata *return_value_and_arguments_metadata = p_method->get_arguments_metadata();
 
-	GDExtensionPropertyInfo *return_value_info = return_value_and_arguments_gdextension_info.data();
-	GDExtensionClassMethodArgumentMetadata *return_value_metadata = return_value_and_arguments_metadata.data();
-	GDExtensionPropertyInfo *arguments_info = return_value_and_arguments_gdextension_info.data() + 1;
-	GDExtensionClassMethodArgumentMetadata *arguments_metadata = return_value_and_arguments_metadata.data() + 1;
+	GDExtensionPropertyInfo *return_value_info = return_value_and_arguments_gdextension_info;
+	const GDExtensionClassMethodArgumentMetadata *return_value_metadata = return_value_and_arguments_metadata;
+	GDExtensionPropertyInfo *arguments_info = return_value_and_arguments_gdextension_info + 1;
+	GDExtensionClassMethodArgumentMetadata *arguments_metadata = const_cast<GDExtensionClassMethodArgumentMetadata *>(return_value_and_arguments_metadata + 1);
 
 	StringName name = p_method->get_name();
 	GDExtensionClassMethodInfo method_info = {
 		name._native_ptr(), // GDExtensionStringNamePtr;
 		p_method, // void *method_userdata;
-		MethodBind::bind_call, // GDExtensionClassMethodCall call_func;
-		MethodBind::bind_ptrcall, // GDExtensionClassMethodPtrCall ptrcall_func;
+		p_method->get_call_func(), // GDExtensionClassMethodCall call_func;
+		p_method->get_ptrcall_func(), // GDExtensionClassMethodPtrCall ptrcall_func;
 		p_method->get_hint_flags(), // uint32_t method_flags; /* GDExtensionClassMethodFlags */
 		(GDExtensionBool)p_method->has_return(), // GDExtensionBool has_return_value;
 		return_value_info, // GDExtensionPropertyInfo *
@@ -229,9 +236,14 @@ void ClassDB::bind_method_godot(const StringName &p_class_name, MethodBind *p_me
 		arguments_info, // GDExtensionPropertyInfo *
 		arguments_metadata, // GDExtensionClassMethodArgumentMetadata *
 		(uint32_t)p_method->get_default_argument_count(), // uint32_t default_argument_count;
-		def_args.data(), // GDExtensionVariantPtr *default_arguments;
+		def_args, // GDExtensionVariantPtr *default_arguments;
 	};
 	internal::gdextension_interface_classdb_register_extension_class_method(internal::library, p_class_name._native_ptr(), &method_info);
+
+	for (int i = 0; i < info_count; i++) {
+		return_value_and_arguments_info[i].~PropertyInfo();
+	}
+	registration_arena.reset_to(mark);
 }
 
 void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal) {
@@ -285,17 +297,66 @@ void ClassDB::bind_integer_constant(const StringName &p_class_name, const String
 	// Register it with Godot
 	internal::gdextension_interface_classdb_register_extension_class_integer_constant(internal::library, p_class_name._native_ptr(), p_enum_name._native_ptr(), p_constant_name._native_ptr(), p_constant_value, p_is_bitfield);
 }
+
+static _FORCE_INLINE_ uint32_t _virtual_table_hash(const void *p_name, uint32_t p_hash) {
+	return uint32_t(((uint64_t(reinterpret_cast<uintptr_t>(p_name)) ^ p_hash) * 0x9E3779B97F4A7C15) >> 32);
+}
+
+void ClassDB::_build_virtual_table(ClassInfo &p_cl) {
+	uint32_t count = 0;
+	for (const ClassInfo *type = &p_cl; type != nullptr; type = type->parent_ptr) {
+		count += type->virtual_methods.size();
+	}
+
+	// Keep the load factor at or below 50%, so there's always an empty slot to end a probe.
+	uint32_t capacity = 2;
+	while (capacity < count * 2) {
+		capacity <<= 1;
+	}
+	const uint32_t mask = capacity - 1;
+
+	std::vector<ClassInfo::VirtualTableEntry> table(capacity);
+	// Walk from the class itself to its parents, so that the most derived implementation wins.
+	for (const ClassInfo *type = &p_cl; type != nullptr; type = type->parent_ptr) {
+		for (const std::pair<const StringName, ClassInfo::VirtualMethod> &method : type->virtual_methods) {
+			const void *name_key = *reinterpret_cast<const void *const *>(method.first._native_ptr());
+			for (uint32_t pos = _virtual_table_hash(name_key, method.second.hash) & mask;; pos = (pos + 1) & mask) {
+				ClassInfo::VirtualTableEntry &entry = table[pos];
+				if (entry.name == nullptr) {
+					entry.name = name_key;
+					entry.method = method.second;
+					break;
+				}
+				if (entry.name == name_key && entry.method.hash == method.second.hash) {
+					break;
+				}
+			}
+		}
+	}
+
+	p_cl.virtual_table = std::move(table);
+}
+
 GDExtensionClassCallVirtual ClassDB::get_virtual_func(void *p_userdata, GDExtensionConstStringNamePtr p_name, uint32_t p_hash) {
 	// This is called by Godot the first time it calls a virtual function, and it caches the result, per object instance.
 	// Because of this, it can happen from different threads at once.
 	// It should be ok not using any mutex as long as we only READ data.
-	const StringName *class_name = reinterpret_cast<const StringName *>(p_userdata);
+	const ClassInfo *type = reinterpret_cast<const ClassInfo *>(p_userdata);
 	const StringName *name = reinterpret_cast<const StringName *>(p_name);
 
-	std::unordered_map<StringName, ClassInfo>::iterator type_it = classes.find(*class_name);
-	ERR_FAIL_COND_V_MSG(type_it == classes.end(), nullptr, String("Class '{0}' doesn't exist.").format(Array::make(*class_name)));
-
-	const ClassInfo *type = &type_it->second;
+	const void *name_key = *reinterpret_cast<const void *const *>(p_name);
+	if (likely(!type->virtual_table.empty() && name_key != nullptr)) {
+		const uint32_t mask = type->virtual_table.size() - 1;
+		for (uint32_t pos = _virtual_table_hash(name_key, p_hash) & mask;; pos = (pos + 1) & mask) {
+			const ClassInfo::VirtualTableEntry &entry = type->virtual_table[pos];
+			if (entry.name == nullptr) {
+				return nullptr;
+			}
+			if (entry.name == name_key && entry.method.hash == p_hash) {
+				return entry.method.func;
+			}
+		}
+	}
 
 	// Find method in current class, or any of its parent classes (Godot classes not included)
 	while (type != nullptr) {
@@ -311,9 +372,99 @@ GDExtensionClassCallVirtual ClassDB::get_virtual_func(void *p_userdata, GDExtens
 	return nullptr;
 }
 
+namespace {
+
+// Lock-free cache of binding callbacks, keyed by the address of the engine's interned class name.
+// Looking up the unordered_map costs several engine calls to hash and compare the name, which adds
+// up when wrapping every object returned by the engine. Every entry holds a reference to its name,
+// so the engine can't free it and reuse the address for another name while the entry exists.
+// Entries are only removed on deinitialization.
+class InstanceBindingCallbacksCache {
+	static constexpr uint32_t SIZE = 1024;
+	static constexpr uint32_t MAX_PROBES = 16;
+
+	struct Slot {
+		std::atomic<const void *> key = nullptr;
+		std::atomic<const GDExtensionInstanceBindingCallbacks *> callbacks = nullptr;
+		StringName *name = nullptr; // Only written by the thread that claimed the key.
+	};
+
+	Slot slots[SIZE];
+
+	_FORCE_INLINE_ static uint32_t _hash(const void *p_key) {
+		return uint32_t((uint64_t(reinterpret_cast<uintptr_t>(p_key)) * 0x9E3779B97F4A7C15) >> 32) & (SIZE - 1);
+	}
+
+public:
+	_FORCE_INLINE_ static const void *get_key(const StringName &p_class) {
+		return *reinterpret_cast<const void *const *>(p_class._native_ptr());
+	}
+
+	const GDExtensionInstanceBindingCallbacks *get(const void *p_key) const {
+		uint32_t pos = _hash(p_key);
+		for (uint32_t i = 0; i < MAX_PROBES; i++) {
+			const Slot &slot = slots[(pos + i) & (SIZE - 1)];
+			const void *key = slot.key.load(std::memory_order_acquire);
+			if (key == p_key) {
+				// May still be null if the entry is being inserted, which is treated as a miss.
+				return slot.callbacks.load(std::memory_order_acquire);
+			}
+			if (key == nullptr) {
+				break;
+			}
+		}
+		return nullptr;
+	}
+
+	void insert(const StringName &p_class, const GDExtensionInstanceBindingCallbacks *p_callbacks) {
+		const void *p_key = get_key(p_class);
+		uint32_t pos = _hash(p_key);
+		for (uint32_t i = 0; i < MAX_PROBES; i++) {
+			Slot &slot = slots[(pos + i) & (SIZE - 1)];
+			const void *key = slot.key.load(std::memory_order_acquire);
+			if (key == nullptr && slot.key.compare_exchange_strong(key, p_key, std::memory_order_acq_rel)) {
+				slot.name = memnew(StringName(p_class));
+				key = p_key;
+			}
+			if (key == p_key) {
+				slot.callbacks.store(p_callbacks, std::memory_order_release);
+				return;
+			}
+		}
+		// Too many collisions, lookups for this class will keep taking the slow path.
+	}
+
+	// Not thread safe, only called while no objects are being wrapped.
+	void clear() {
+		for (Slot &slot : slots) {
+			slot.callbacks.store(nullptr, std::memory_order_relaxed);
+			slot.key.store(nullptr, std::memory_order_relaxed);
+			if (slot.name) {
+				memdelete(slot.name);
+				slot.name = nullptr;
+			}
+		}
+	}
+};
+
+constinit InstanceBindingCallbacksCache instance_binding_callbacks_cache;
+
+} // namespace
+
 const GDExtensionInstanceBindingCallbacks *ClassDB::get_instance_binding_callbacks(const StringName &p_class) {
+	const void *cache_key = InstanceBindingCallbacksCache::get_key(p_class);
+	if (likely(cache_key != nullptr)) {
+		const GDExtensionInstanceBindingCallbacks *cached = instance_binding_callbacks_cache.get(cache_key);
+		if (likely(cached != nullptr)) {
+			return cached;
+		}
+	}
+
 	std::unordered_map<StringName, const GDExtensionInstanceBindingCallbacks *>::iterator callbacks_it = instance_binding_callbacks.find(p_class);
 	if (likely(callbacks_it != instance_binding_callbacks.end())) {
+		if (cache_key != nullptr) {
+			instance_binding_callbacks_cache.insert(p_class, callbacks_it->second);
+		}
 		return callbacks_it->second;
 	}
 
@@ -325,6 +476,10 @@ const GDExtensionInstanceBindingCallbacks *ClassDB::get_instance_binding_callbac
 		callbacks_it = instance_binding_callbacks.find(class_name);
 	} while (callbacks_it == instance_binding_callbacks.end());
 
+	// Remember the result of the walk, so it isn't repeated for every object of this class.
+	if (cache_key != nullptr) {
+		instance_binding_callbacks_cache.insert(p_class, callbacks_it->second);
+	}
 	return callbacks_it->second;
 }
 
@@ -341,6 +496,21 @@ void ClassDB::bind_virtual_method(const StringName &p_class, const StringName &p
 		p_call,
 		p_hash,
 	};
+
+	// Bound after the class finished registering, the table needs to be rebuilt,
+	// as do those of derived classes that were already registered, since they copy it.
+	for (std::pair<const StringName, ClassInfo> &pair : classes) {
+		ClassInfo &cl = pair.second;
+		if (cl.virtual_table.empty()) {
+			continue;
+		}
+		for (const ClassInfo *ancestor = &cl; ancestor != nullptr; ancestor = ancestor->parent_ptr) {
+			if (ancestor == &type) {
+				_build_virtual_table(cl);
+				break;
+			}
+		}
+	}
 }
 
 void ClassDB::add_virtual_method(const StringName &p_class, const MethodInfo &p_method, const Vector<StringName> &p_arg_names) {
@@ -388,10 +558,15 @@ void ClassDB::add_virtual_method(const StringName &p_class, const MethodInfo &p_
 	}
 }
 
-void ClassDB::initialize_class(const ClassInfo &p_cl) {
+void ClassDB::initialize_class(ClassInfo &p_cl) {
+	// All virtuals of the class and its parents are bound at this point.
+	_build_virtual_table(p_cl);
 }
 
 void ClassDB::initialize(GDExtensionInitializationLevel p_level) {
+	// Registration for this level is done.
+	registration_arena.free_memory();
+
 	for (const std::pair<StringName, ClassInfo> pair : classes) {
 		const ClassInfo &cl = pair.second;
 		if (cl.level != p_level) {
@@ -403,6 +578,9 @@ void ClassDB::initialize(GDExtensionInitializationLevel p_level) {
 }
 
 void ClassDB::deinitialize(GDExtensionInitializationLevel p_level) {
+	// Names of the classes unregistered below may be freed and their addresses reused.
+	instance_binding_callbacks_cache.clear();
+
 	std::set<StringName> to_erase;
 	for (std::vector<StringName>::reverse_iterator i = class_register_order.rbegin(); i != class_register_order.rend(); ++i) {
 		const StringName &name = *i;
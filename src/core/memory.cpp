@@ -31,6 +31,9 @@
 #include <godot_cpp/core/memory.hpp>
 
 #include <godot_cpp/godot.hpp>
+#include <godot_cpp/templates/spin_lock.hpp>
+
+#include <atomic>
 
 namespace godot {
 
@@ -93,6 +96,233 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 	internal::gdextension_interface_mem_free(mem);
 }
 
+void *Memory::alloc_aligned_static(size_t p_bytes, size_t p_alignment) {
+	ERR_FAIL_COND_V(p_alignment == 0 || (p_alignment & (p_alignment - 1)) != 0, nullptr);
+	// The offset below must be aligned too, free_aligned_static() relies on it.
+	if (p_alignment < alignof(uint32_t)) {
+		p_alignment = alignof(uint32_t);
+	}
+
+	// The distance back to the start of the allocation is kept just before the aligned pointer.
+	uint8_t *mem = (uint8_t *)alloc_static(p_bytes + p_alignment - 1 + sizeof(uint32_t));
+	ERR_FAIL_NULL_V(mem, nullptr);
+	uint8_t *aligned = (uint8_t *)(((uintptr_t)mem + sizeof(uint32_t) + p_alignment - 1) & ~uintptr_t(p_alignment - 1));
+	*((uint32_t *)aligned - 1) = (uint32_t)(aligned - mem);
+	return aligned;
+}
+
+void Memory::free_aligned_static(void *p_memory) {
+	if (p_memory == nullptr) {
+		return;
+	}
+	// At least alignof(uint32_t) aligned, see alloc_aligned_static().
+	uint8_t *aligned = (uint8_t *)p_memory;
+	free_static(aligned - *((uint32_t *)aligned - 1));
+}
+
+namespace {
+
+struct PoolBlock {
+	PoolBlock *next;
+};
+
+// Stored at the start of every page, blocks follow at GRANULARITY.
+struct PoolPage {
+	PoolPage *next;
+};
+
+static_assert(sizeof(PoolPage) <= MemoryPool::GRANULARITY);
+
+struct PoolSizeClass {
+	SpinLock lock;
+	PoolBlock *free_list = nullptr;
+	uint32_t free_count = 0;
+	PoolPage *pages = nullptr;
+	uint32_t block_count = 0; // Carved out of pages, free or not.
+};
+
+// Constant initialized and trivially destructible, so containers created or
+// released during static initialization and destruction can still use it.
+struct PoolGlobals {
+	PoolSizeClass classes[MemoryPool::SIZE_CLASS_COUNT];
+	std::atomic<uint64_t> reserved_bytes = 0;
+};
+
+constinit PoolGlobals pool_globals;
+
+// Blocks moved between a thread cache and the shared lists at once.
+constexpr uint32_t POOL_BATCH_SIZE = 32;
+constexpr uint32_t POOL_CACHE_LIMIT = POOL_BATCH_SIZE * 2;
+
+struct PoolThreadCache {
+	struct Bin {
+		PoolBlock *head = nullptr;
+		uint32_t count = 0;
+	};
+	Bin bins[MemoryPool::SIZE_CLASS_COUNT];
+};
+
+constinit thread_local PoolThreadCache pool_thread_cache;
+
+_FORCE_INLINE_ uint32_t pool_size_class(size_t p_bytes) {
+	return p_bytes == 0 ? 0 : uint32_t((p_bytes - 1) / MemoryPool::GRANULARITY);
+}
+
+// Moves up to p_count blocks from the head of r_from to the head of r_to.
+uint32_t pool_move_blocks(PoolBlock *&r_from, PoolBlock *&r_to, uint32_t p_count) {
+	uint32_t moved = 0;
+	while (r_from && moved < p_count) {
+		PoolBlock *b = r_from;
+		r_from = b->next;
+		b->next = r_to;
+		r_to = b;
+		moved++;
+	}
+	return moved;
+}
+
+void pool_flush_bin(uint32_t p_class, PoolThreadCache::Bin &p_bin, uint32_t p_count) {
+	PoolSizeClass &sc = pool_globals.classes[p_class];
+	sc.lock.lock();
+	uint32_t moved = pool_move_blocks(p_bin.head, sc.free_list, p_count);
+	sc.free_count += moved;
+	sc.lock.unlock();
+	p_bin.count -= moved;
+}
+
+void pool_refill_bin(uint32_t p_class, PoolThreadCache::Bin &p_bin) {
+	PoolSizeClass &sc = pool_globals.classes[p_class];
+	sc.lock.lock();
+	if (sc.free_list) {
+		uint32_t moved = pool_move_blocks(sc.free_list, p_bin.head, POOL_BATCH_SIZE);
+		sc.free_count -= moved;
+		sc.lock.unlock();
+		p_bin.count += moved;
+		return;
+	}
+	sc.lock.unlock();
+
+	// Shared list is empty too, carve a new page straight into this thread's cache.
+	uint8_t *page = (uint8_t *)Memory::alloc_static(MemoryPool::PAGE_SIZE);
+	ERR_FAIL_NULL(page);
+	pool_globals.reserved_bytes.fetch_add(MemoryPool::PAGE_SIZE, std::memory_order_relaxed);
+
+	size_t block_size = (p_class + 1) * MemoryPool::GRANULARITY;
+	uint32_t block_count = uint32_t((MemoryPool::PAGE_SIZE - MemoryPool::GRANULARITY) / block_size);
+	uint8_t *blocks = page + MemoryPool::GRANULARITY;
+
+	sc.lock.lock();
+	((PoolPage *)page)->next = sc.pages;
+	sc.pages = (PoolPage *)page;
+	sc.block_count += block_count;
+	sc.lock.unlock();
+
+	for (uint32_t i = block_count; i > 0; i--) {
+		PoolBlock *b = (PoolBlock *)(blocks + (i - 1) * block_size);
+		b->next = p_bin.head;
+		p_bin.head = b;
+	}
+	p_bin.count += block_count;
+}
+
+// Hands the cached blocks of an exiting thread back to the shared lists.
+struct PoolThreadCacheFlusher {
+	~PoolThreadCacheFlusher() {
+		for (uint32_t i = 0; i < MemoryPool::SIZE_CLASS_COUNT; i++) {
+			PoolThreadCache::Bin &bin = pool_thread_cache.bins[i];
+			if (bin.count) {
+				pool_flush_bin(i, bin, bin.count);
+			}
+		}
+	}
+};
+
+thread_local PoolThreadCacheFlusher pool_thread_cache_flusher;
+
+} // namespace
+
+void *MemoryPool::alloc(size_t p_bytes) {
+	if (unlikely(p_bytes > MAX_BLOCK_SIZE)) {
+		return Memory::alloc_static(p_bytes);
+	}
+
+	uint32_t size_class = pool_size_class(p_bytes);
+	PoolThreadCache::Bin &bin = pool_thread_cache.bins[size_class];
+	if (unlikely(bin.head == nullptr)) {
+		// Touch the flusher so it gets constructed, and destroyed at thread exit.
+		(void)&pool_thread_cache_flusher;
+		pool_refill_bin(size_class, bin);
+		ERR_FAIL_NULL_V(bin.head, nullptr);
+	}
+
+	PoolBlock *b = bin.head;
+	bin.head = b->next;
+	bin.count--;
+	return b;
+}
+
+void MemoryPool::free(void *p_ptr, size_t p_bytes) {
+	if (p_ptr == nullptr) {
+		return;
+	}
+	if (unlikely(p_bytes > MAX_BLOCK_SIZE)) {
+		Memory::free_static(p_ptr);
+		return;
+	}
+
+	uint32_t size_class = pool_size_class(p_bytes);
+	PoolThreadCache::Bin &bin = pool_thread_cache.bins[size_class];
+	if (unlikely(bin.head == nullptr)) {
+		// Threads that only free (e.g. consumers) also need to hand their blocks back.
+		(void)&pool_thread_cache_flusher;
+	}
+	PoolBlock *b = (PoolBlock *)p_ptr;
+	b->next = bin.head;
+	bin.head = b;
+	bin.count++;
+
+	if (unlikely(bin.count > POOL_CACHE_LIMIT)) {
+		pool_flush_bin(size_class, bin, POOL_BATCH_SIZE);
+	}
+}
+
+void MemoryPool::release_unused_pages() {
+	// Only this thread's cache can be reclaimed, blocks cached by other live
+	// threads keep their size class alive.
+	for (uint32_t i = 0; i < SIZE_CLASS_COUNT; i++) {
+		PoolThreadCache::Bin &bin = pool_thread_cache.bins[i];
+		if (bin.count) {
+			pool_flush_bin(i, bin, bin.count);
+		}
+	}
+
+	for (uint32_t i = 0; i < SIZE_CLASS_COUNT; i++) {
+		PoolSizeClass &sc = pool_globals.classes[i];
+		sc.lock.lock();
+		if (sc.free_count != sc.block_count) {
+			sc.lock.unlock();
+			continue;
+		}
+		PoolPage *page = sc.pages;
+		sc.pages = nullptr;
+		sc.free_list = nullptr;
+		sc.free_count = 0;
+		sc.block_count = 0;
+		sc.lock.unlock();
+
+		while (page) {
+			PoolPage *next = page->next;
+			Memory::free_static(page);
+			pool_globals.reserved_bytes.fetch_sub(PAGE_SIZE, std::memory_order_relaxed);
+			page = next;
+		}
+	}
+}
+
+uint64_t MemoryPool::get_reserved_bytes() {
+	return pool_globals.reserved_bytes.load(std::memory_order_relaxed);
+}
+
 _GlobalNil::_GlobalNil() {
 	left = this;
 	right = this;
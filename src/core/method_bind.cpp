@@ -74,12 +74,17 @@ void MethodBind::generate_argument_types(int p_count) {
 	if (argument_types != nullptr) {
 		memdelete_arr(argument_types);
 	}
+	if (argument_metadata != nullptr) {
+		memdelete_arr(argument_metadata);
+	}
 
 	argument_types = memnew_arr(GDExtensionVariantType, p_count + 1);
+	argument_metadata = memnew_arr(GDExtensionClassMethodArgumentMetadata, p_count + 1);
 
 	// -1 means return type.
 	for (int i = -1; i < p_count; i++) {
 		argument_types[i + 1] = gen_argument_type(i);
+		argument_metadata[i + 1] = get_argument_metadata(i);
 	}
 }
 
@@ -93,10 +98,10 @@ PropertyInfo MethodBind::get_argument_info(int p_argument) const {
 
 void MethodBind::bind_call(void *p_method_userdata, GDExtensionClassInstancePtr p_instance, const GDExtensionConstVariantPtr *p_args, GDExtensionInt p_argument_count, GDExtensionVariantPtr r_return, GDExtensionCallError *r_error) {
 	const MethodBind *bind = reinterpret_cast<const MethodBind *>(p_method_userdata);
-	Variant ret = bind->call(p_instance, p_args, p_argument_count, *r_error);
 	// This assumes the return value is an empty Variant, so it doesn't need to call the destructor first.
 	// Since only GDExtensionMethodBind calls this from the Godot side, it should always be the case.
-	internal::gdextension_interface_variant_new_copy(r_return, ret._native_ptr());
+	// The returned Variant is constructed directly in place, without a copy through the engine.
+	memnew_placement(r_return, Variant(bind->call(p_instance, p_args, p_argument_count, *r_error)));
 }
 
 void MethodBind::bind_ptrcall(void *p_method_userdata, GDExtensionClassInstancePtr p_instance, const GDExtensionConstTypePtr *p_args, GDExtensionTypePtr r_return) {
@@ -108,6 +113,9 @@ MethodBind::~MethodBind() {
 	if (argument_types) {
 		memdelete_arr(argument_types);
 	}
+	if (argument_metadata) {
+		memdelete_arr(argument_metadata);
+	}
 }
 
 } // namespace godot
@@ -0,0 +1,145 @@
+/**************************************************************************/
+/*  startup_profiler.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifdef STARTUP_PROFILING_ENABLED
+
+#include <godot_cpp/core/startup_profiler.hpp>
+
+#include <godot_cpp/variant/string_name.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace godot {
+
+namespace internal {
+
+namespace {
+
+struct PhaseRecord {
+	const char *name = nullptr;
+	uint64_t usec = 0;
+	uint32_t calls = 0;
+};
+
+struct ClassRecord {
+	std::string name;
+	uint64_t usec = 0;
+	uint32_t method_count = 0;
+};
+
+// Only filled in while loading, and emptied by every report.
+std::vector<PhaseRecord> &get_phase_records() {
+	static std::vector<PhaseRecord> records;
+	return records;
+}
+
+std::vector<ClassRecord> &get_class_records() {
+	static std::vector<ClassRecord> records;
+	return records;
+}
+
+const char *get_level_name(GDExtensionInitializationLevel p_level) {
+	switch (p_level) {
+		case GDEXTENSION_INITIALIZATION_CORE:
+			return "core";
+		case GDEXTENSION_INITIALIZATION_SERVERS:
+			return "servers";
+		case GDEXTENSION_INITIALIZATION_SCENE:
+			return "scene";
+		case GDEXTENSION_INITIALIZATION_EDITOR:
+			return "editor";
+		default:
+			return "unknown";
+	}
+}
+
+void append_json_string(std::string &r_json, const char *p_str) {
+	r_json += '"';
+	for (const char *c = p_str; *c; c++) {
+		if (*c == '"' || *c == '\\') {
+			r_json += '\\';
+		}
+		r_json += *c;
+	}
+	r_json += '"';
+}
+
+} // namespace
+
+void StartupProfiler::add_phase(const char *p_phase, uint64_t p_usec) {
+	std::vector<PhaseRecord> &records = get_phase_records();
+	for (PhaseRecord &record : records) {
+		if (strcmp(record.name, p_phase) == 0) {
+			record.usec += p_usec;
+			record.calls++;
+			return;
+		}
+	}
+	records.push_back({ p_phase, p_usec, 1 });
+}
+
+void StartupProfiler::add_class(const StringName &p_class, uint64_t p_usec, uint32_t p_method_count) {
+	get_class_records().push_back({ String(p_class).utf8().get_data(), p_usec, p_method_count });
+}
+
+void StartupProfiler::report(GDExtensionInitializationLevel p_level) {
+	std::vector<PhaseRecord> &phases = get_phase_records();
+	std::vector<ClassRecord> &classes = get_class_records();
+
+	std::string json = "{\"level\":";
+	append_json_string(json, get_level_name(p_level));
+	json += ",\"phases\":[";
+	for (size_t i = 0; i < phases.size(); i++) {
+		json += i == 0 ? "{\"name\":" : ",{\"name\":";
+		append_json_string(json, phases[i].name);
+		json += ",\"usec\":" + std::to_string(phases[i].usec) + ",\"calls\":" + std::to_string(phases[i].calls) + "}";
+	}
+	json += "],\"classes\":[";
+	for (size_t i = 0; i < classes.size(); i++) {
+		json += i == 0 ? "{\"name\":" : ",{\"name\":";
+		append_json_string(json, classes[i].name.c_str());
+		json += ",\"usec\":" + std::to_string(classes[i].usec) + ",\"methods\":" + std::to_string(classes[i].method_count) + "}";
+	}
+	json += "]}";
+
+	UtilityFunctions::print(String("godot-cpp startup profile: ") + String::utf8(json.c_str(), json.size()));
+
+	phases.clear();
+	classes.clear();
+}
+
+} // namespace internal
+
+} // namespace godot
+
+#endif // STARTUP_PROFILING_ENABLED
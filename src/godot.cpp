@@ -34,7 +34,9 @@
 #include <godot_cpp/classes/wrapped.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/core/memory.hpp>
+#include <godot_cpp/core/startup_profiler.hpp>
 #include <godot_cpp/core/version.hpp>
+#include <godot_cpp/templates/arena.hpp>
 #include <godot_cpp/variant/variant.hpp>
 
 #include <godot_cpp/core/error_macros.hpp>
@@ -305,6 +307,8 @@ GDExtensionBool GDExtensionBinding::init(GDExtensionInterfaceGetProcAddress p_ge
 	internal::library = p_library;
 	internal::token = p_library;
 
+	STARTUP_PROFILE_BEGIN(load_interface);
+
 	LOAD_PROC_ADDRESS(get_godot_version, GDExtensionInterfaceGetGodotVersion);
 	internal::gdextension_interface_get_godot_version(&internal::godot_version);
 
@@ -491,13 +495,21 @@ GDExtensionBool GDExtensionBinding::init(GDExtensionInterfaceGetProcAddress p_ge
 	LOAD_PROC_ADDRESS(image_ptrw, GDExtensionInterfaceImagePtrw);
 	LOAD_PROC_ADDRESS(image_ptr, GDExtensionInterfaceImagePtr);
 
+	STARTUP_PROFILE_END(load_interface);
+
 	r_initialization->initialize = initialize_level;
 	r_initialization->deinitialize = deinitialize_level;
 	r_initialization->userdata = p_init_data;
 	r_initialization->minimum_initialization_level = p_init_data->minimum_initialization_level;
 
-	Variant::init_bindings();
-	godot::internal::register_engine_classes();
+	{
+		STARTUP_PROFILE_BEGIN(variant_init_bindings);
+		Variant::init_bindings();
+	}
+	{
+		STARTUP_PROFILE_BEGIN(register_engine_classes);
+		godot::internal::register_engine_classes();
+	}
 
 	api_initialized = true;
 	return true;
@@ -510,12 +522,20 @@ void GDExtensionBinding::initialize_level(void *p_userdata, GDExtensionInitializ
 	ERR_FAIL_COND(static_cast<ModuleInitializationLevel>(p_level) >= MODULE_INITIALIZATION_LEVEL_MAX);
 	ClassDB::current_level = p_level;
 
+	// Every engine class outside the editor is registered by the scene level.
+	if (p_level == GDEXTENSION_INITIALIZATION_SCENE || p_level == GDEXTENSION_INITIALIZATION_EDITOR) {
+		STARTUP_PROFILE_BEGIN(resolve_engine_method_binds);
+		internal::resolve_engine_method_binds(p_level);
+	}
+
 	InitData *init_data = static_cast<InitData *>(p_userdata);
 	if (init_data && init_data->init_callback) {
+		STARTUP_PROFILE_BEGIN(init_callback);
 		init_data->init_callback(static_cast<ModuleInitializationLevel>(p_level));
 	}
 
 	if (level_initialized[p_level] == 0) {
+		STARTUP_PROFILE_BEGIN(classdb_initialize);
 		ClassDB::initialize(p_level);
 	}
 	level_initialized[p_level]++;
@@ -526,6 +546,10 @@ void GDExtensionBinding::initialize_level(void *p_userdata, GDExtensionInitializ
 			doc_data.load_data();
 		}
 	}
+
+#ifdef STARTUP_PROFILING_ENABLED
+	internal::StartupProfiler::report(p_level);
+#endif
 }
 
 void GDExtensionBinding::deinitialize_level(void *p_userdata, GDExtensionInitializationLevel p_level) {
@@ -541,6 +565,16 @@ void GDExtensionBinding::deinitialize_level(void *p_userdata, GDExtensionInitial
 	if (level_initialized[p_level] == 0) {
 		EditorPlugins::deinitialize(p_level);
 		ClassDB::deinitialize(p_level);
+		internal::clear_engine_method_binds(p_level);
+
+		// Nothing of the extension should outlive the core level, so the pool
+		// can give its pages back before the library is unloaded or reloaded.
+		// The same goes for this thread's frame arena, which would otherwise
+		// be freed at process exit, after the engine is gone.
+		if (p_level == GDEXTENSION_INITIALIZATION_CORE) {
+			MemoryPool::release_unused_pages();
+			FrameArena::free_memory();
+		}
 	}
 }
 
@@ -0,0 +1,262 @@
+/**************************************************************************/
+/*  aabb_batch.cpp                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/variant/aabb_batch.hpp>
+
+#include <godot_cpp/core/simd.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/projection.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+#include <godot_cpp/variant/variant.hpp>
+
+#include <bit>
+
+namespace godot {
+
+using simd::RealV;
+
+void AABBBatch::_resize_storage(uint32_t p_count) {
+	uint32_t old_padded = min_x.size();
+	uint32_t padded = (p_count + RealV::WIDTH - 1) / RealV::WIDTH * RealV::WIDTH;
+	LocalVector<real_t> *arrays[6] = { &min_x, &min_y, &min_z, &max_x, &max_y, &max_z };
+	for (LocalVector<real_t> *array : arrays) {
+		array->resize(padded);
+		for (uint32_t i = old_padded; i < padded; i++) {
+			(*array)[i] = 0;
+		}
+	}
+}
+
+// Runs p_test on every register of boxes and packs the lanes of the masks it returns.
+template <typename F>
+void AABBBatch::_write_mask(uint64_t *r_mask, F p_test) const {
+	if (count == 0) {
+		return;
+	}
+
+	uint32_t padded = min_x.size();
+	uint64_t word = 0;
+	for (uint32_t i = 0; i < padded; i += RealV::WIDTH) {
+		word |= uint64_t(mask_bits(p_test(i))) << (i & 63);
+		if (((i + RealV::WIDTH) & 63) == 0) {
+			r_mask[i >> 6] = word;
+			word = 0;
+		}
+	}
+	if (padded & 63) {
+		r_mask[padded >> 6] = word;
+	}
+	if (count & 63) {
+		r_mask[count >> 6] &= (uint64_t(1) << (count & 63)) - 1;
+	}
+}
+
+void AABBBatch::clear() {
+	min_x.clear();
+	min_y.clear();
+	min_z.clear();
+	max_x.clear();
+	max_y.clear();
+	max_z.clear();
+	count = 0;
+}
+
+void AABBBatch::reserve(uint32_t p_count) {
+	uint32_t padded = (p_count + RealV::WIDTH - 1) / RealV::WIDTH * RealV::WIDTH;
+	min_x.reserve(padded);
+	min_y.reserve(padded);
+	min_z.reserve(padded);
+	max_x.reserve(padded);
+	max_y.reserve(padded);
+	max_z.reserve(padded);
+}
+
+uint32_t AABBBatch::push_back(const AABB &p_aabb) {
+	if (count == min_x.size()) {
+		_resize_storage(count + 1);
+	}
+	set(count, p_aabb);
+	return count++;
+}
+
+void AABBBatch::set(uint32_t p_index, const AABB &p_aabb) {
+	ERR_FAIL_UNSIGNED_INDEX(p_index, min_x.size());
+	Vector3 end = p_aabb.position + p_aabb.size;
+	min_x[p_index] = p_aabb.position.x;
+	min_y[p_index] = p_aabb.position.y;
+	min_z[p_index] = p_aabb.position.z;
+	max_x[p_index] = end.x;
+	max_y[p_index] = end.y;
+	max_z[p_index] = end.z;
+}
+
+AABB AABBBatch::get(uint32_t p_index) const {
+	ERR_FAIL_UNSIGNED_INDEX_V(p_index, count, AABB());
+	Vector3 begin(min_x[p_index], min_y[p_index], min_z[p_index]);
+	Vector3 end(max_x[p_index], max_y[p_index], max_z[p_index]);
+	return AABB(begin, end - begin);
+}
+
+void AABBBatch::remove_at_unordered(uint32_t p_index) {
+	ERR_FAIL_UNSIGNED_INDEX(p_index, count);
+	count--;
+	LocalVector<real_t> *arrays[6] = { &min_x, &min_y, &min_z, &max_x, &max_y, &max_z };
+	for (LocalVector<real_t> *array : arrays) {
+		(*array)[p_index] = (*array)[count];
+		(*array)[count] = 0;
+	}
+	if (count % RealV::WIDTH == 0) {
+		_resize_storage(count);
+	}
+}
+
+void AABBBatch::intersects(const AABB &p_aabb, uint64_t *r_mask) const {
+	Vector3 end = p_aabb.position + p_aabb.size;
+	const RealV begin_x = RealV::splat(p_aabb.position.x), begin_y = RealV::splat(p_aabb.position.y), begin_z = RealV::splat(p_aabb.position.z);
+	const RealV end_x = RealV::splat(end.x), end_y = RealV::splat(end.y), end_z = RealV::splat(end.z);
+
+	_write_mask(r_mask, [&](uint32_t i) {
+		return cmp_lt(RealV::load(&min_x[i]), end_x) & cmp_gt(RealV::load(&max_x[i]), begin_x) &
+				cmp_lt(RealV::load(&min_y[i]), end_y) & cmp_gt(RealV::load(&max_y[i]), begin_y) &
+				cmp_lt(RealV::load(&min_z[i]), end_z) & cmp_gt(RealV::load(&max_z[i]), begin_z);
+	});
+}
+
+void AABBBatch::intersects_ray(const Vector3 &p_from, const Vector3 &p_dir, uint64_t *r_mask) const {
+	const LocalVector<real_t> *mins[3] = { &min_x, &min_y, &min_z };
+	const LocalVector<real_t> *maxs[3] = { &max_x, &max_y, &max_z };
+
+	_write_mask(r_mask, [&](uint32_t i) {
+		// Slab test, the sign of each direction component decides which face is entered first.
+		RealV clip_near = RealV::splat(-1e20);
+		RealV clip_far = RealV::splat(1e20);
+		RealV hit = simd::mask_splat(true);
+		for (int k = 0; k < 3; k++) {
+			RealV box_min = RealV::load(&(*mins[k])[i]);
+			RealV box_max = RealV::load(&(*maxs[k])[i]);
+			RealV from = RealV::splat(p_from[k]);
+			if (p_dir[k] == 0) {
+				hit = hit & cmp_ge(from, box_min) & cmp_le(from, box_max);
+				continue;
+			}
+			RealV dir = RealV::splat(p_dir[k]);
+			RealV c1 = (box_min - from) / dir;
+			RealV c2 = (box_max - from) / dir;
+			if (p_dir[k] < 0) {
+				SWAP(c1, c2);
+			}
+			clip_near = max(clip_near, c1);
+			clip_far = min(clip_far, c2);
+		}
+		return hit & cmp_le(clip_near, clip_far) & cmp_ge(clip_far, RealV::splat(0));
+	});
+}
+
+void AABBBatch::intersects_convex_shape(const Plane *p_planes, int p_plane_count, const Vector3 *p_points, int p_point_count, uint64_t *r_mask) const {
+	// No box can be separated from all points when there are none, same as AABB::intersects_convex_shape().
+	if (p_point_count <= 0) {
+		for (uint32_t i = 0; i < get_mask_size(); i++) {
+			r_mask[i] = 0;
+		}
+		return;
+	}
+
+	// A box is separated from the points on an axis when they are all on one side of it.
+	Vector3 points_begin = p_points[0];
+	Vector3 points_end = p_points[0];
+	for (int i = 1; i < p_point_count; i++) {
+		points_begin = points_begin.min(p_points[i]);
+		points_end = points_end.max(p_points[i]);
+	}
+	const RealV points_begin_x = RealV::splat(points_begin.x), points_begin_y = RealV::splat(points_begin.y), points_begin_z = RealV::splat(points_begin.z);
+	const RealV points_end_x = RealV::splat(points_end.x), points_end_y = RealV::splat(points_end.y), points_end_z = RealV::splat(points_end.z);
+
+	_write_mask(r_mask, [&](uint32_t i) {
+		RealV bx0 = RealV::load(&min_x[i]), by0 = RealV::load(&min_y[i]), bz0 = RealV::load(&min_z[i]);
+		RealV bx1 = RealV::load(&max_x[i]), by1 = RealV::load(&max_y[i]), bz1 = RealV::load(&max_z[i]);
+
+		RealV inside = cmp_le(points_begin_x, bx1) & cmp_ge(points_end_x, bx0) &
+				cmp_le(points_begin_y, by1) & cmp_ge(points_end_y, by0) &
+				cmp_le(points_begin_z, bz1) & cmp_ge(points_end_z, bz0);
+
+		// Outside a plane when even the corner furthest behind it is over it.
+		for (int j = 0; j < p_plane_count; j++) {
+			const Plane &p = p_planes[j];
+			RealV dist = RealV::splat(p.normal.x) * (p.normal.x > 0 ? bx0 : bx1) +
+					RealV::splat(p.normal.y) * (p.normal.y > 0 ? by0 : by1) +
+					RealV::splat(p.normal.z) * (p.normal.z > 0 ? bz0 : bz1);
+			inside = inside & cmp_le(dist, RealV::splat(p.d));
+		}
+		return inside;
+	});
+}
+
+void AABBBatch::inside_convex_shape(const Plane *p_planes, int p_plane_count, uint64_t *r_mask) const {
+	_write_mask(r_mask, [&](uint32_t i) {
+		RealV bx0 = RealV::load(&min_x[i]), by0 = RealV::load(&min_y[i]), bz0 = RealV::load(&min_z[i]);
+		RealV bx1 = RealV::load(&max_x[i]), by1 = RealV::load(&max_y[i]), bz1 = RealV::load(&max_z[i]);
+
+		// Inside when the corner furthest in front of every plane is not over it.
+		RealV inside = simd::mask_splat(true);
+		for (int j = 0; j < p_plane_count; j++) {
+			const Plane &p = p_planes[j];
+			RealV dist = RealV::splat(p.normal.x) * (p.normal.x < 0 ? bx0 : bx1) +
+					RealV::splat(p.normal.y) * (p.normal.y < 0 ? by0 : by1) +
+					RealV::splat(p.normal.z) * (p.normal.z < 0 ? bz0 : bz1);
+			inside = inside & cmp_le(dist, RealV::splat(p.d));
+		}
+		return inside;
+	});
+}
+
+void AABBBatch::cull(const Projection &p_projection, const Transform3D &p_transform, uint64_t *r_mask) const {
+	Array planes_array = p_projection.get_projection_planes(p_transform);
+	Plane planes[6];
+	for (int i = 0; i < 6; i++) {
+		planes[i] = planes_array[i];
+	}
+	Vector3 points[8];
+	p_projection.get_endpoints(p_transform, points);
+	intersects_convex_shape(planes, 6, points, 8, r_mask);
+}
+
+uint32_t AABBBatch::mask_to_indices(const uint64_t *p_mask, uint32_t p_count, uint32_t *r_indices) {
+	uint32_t written = 0;
+	for (uint32_t w = 0; w < (p_count + 63) / 64; w++) {
+		uint64_t word = p_mask[w];
+		while (word) {
+			r_indices[written++] = w * 64 + std::countr_zero(word);
+			word &= word - 1;
+		}
+	}
+	return written;
+}
+
+} // namespace godot
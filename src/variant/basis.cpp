@@ -29,6 +29,7 @@
 /**************************************************************************/
 
 #include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/core/simd.hpp>
 #include <godot_cpp/variant/basis.hpp>
 #include <godot_cpp/variant/string.hpp>
 
@@ -712,6 +713,85 @@ bool Basis::operator!=(const Basis &p_matrix) const {
 	return (!(*this == p_matrix));
 }
 
+void Basis::xform_batch(const Vector3 *p_src, Vector3 *r_dst, size_t p_count) const {
+	using simd::RealV;
+	const RealV m00 = RealV::splat(rows[0].x), m01 = RealV::splat(rows[0].y), m02 = RealV::splat(rows[0].z);
+	const RealV m10 = RealV::splat(rows[1].x), m11 = RealV::splat(rows[1].y), m12 = RealV::splat(rows[1].z);
+	const RealV m20 = RealV::splat(rows[2].x), m21 = RealV::splat(rows[2].y), m22 = RealV::splat(rows[2].z);
+
+	size_t i = 0;
+	for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+		RealV x, y, z;
+		simd::load3(p_src[i].coord, x, y, z);
+		simd::store3(r_dst[i].coord,
+				m00 * x + m01 * y + m02 * z,
+				m10 * x + m11 * y + m12 * z,
+				m20 * x + m21 * y + m22 * z);
+	}
+	for (; i < p_count; i++) {
+		r_dst[i] = xform(p_src[i]);
+	}
+}
+
+void Basis::xform_inv_batch(const Vector3 *p_src, Vector3 *r_dst, size_t p_count) const {
+	using simd::RealV;
+	const RealV m00 = RealV::splat(rows[0].x), m01 = RealV::splat(rows[0].y), m02 = RealV::splat(rows[0].z);
+	const RealV m10 = RealV::splat(rows[1].x), m11 = RealV::splat(rows[1].y), m12 = RealV::splat(rows[1].z);
+	const RealV m20 = RealV::splat(rows[2].x), m21 = RealV::splat(rows[2].y), m22 = RealV::splat(rows[2].z);
+
+	size_t i = 0;
+	for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+		RealV x, y, z;
+		simd::load3(p_src[i].coord, x, y, z);
+		simd::store3(r_dst[i].coord,
+				m00 * x + m10 * y + m20 * z,
+				m01 * x + m11 * y + m21 * z,
+				m02 * x + m12 * y + m22 * z);
+	}
+	for (; i < p_count; i++) {
+		r_dst[i] = xform_inv(p_src[i]);
+	}
+}
+
+void Basis::from_quaternion_batch(const Quaternion *p_src, Basis *r_dst, size_t p_count) {
+	// Same expressions as set_quaternion(). The nine elements of each basis are written one lane at a time,
+	// as there is no cheap nine-way interleave.
+	using simd::RealV;
+	const RealV one = RealV::splat(1);
+	const RealV two = RealV::splat(2);
+
+	size_t i = 0;
+	for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+		RealV x, y, z, w;
+		simd::load4(p_src[i].components, x, y, z, w);
+		RealV s = two / (x * x + y * y + z * z + w * w);
+		RealV xs = x * s, ys = y * s, zs = z * s;
+		RealV wx = w * xs, wy = w * ys, wz = w * zs;
+		RealV xx = x * xs, xy = x * ys, xz = x * zs;
+		RealV yy = y * ys, yz = y * zs, zz = z * zs;
+
+		real_t elements[9][RealV::WIDTH];
+		(one - (yy + zz)).store(elements[0]);
+		(xy - wz).store(elements[1]);
+		(xz + wy).store(elements[2]);
+		(xy + wz).store(elements[3]);
+		(one - (xx + zz)).store(elements[4]);
+		(yz - wx).store(elements[5]);
+		(xz - wy).store(elements[6]);
+		(yz + wx).store(elements[7]);
+		(one - (xx + yy)).store(elements[8]);
+		for (int j = 0; j < RealV::WIDTH; j++) {
+			Basis &b = r_dst[i + j];
+			b.rows[0] = Vector3(elements[0][j], elements[1][j], elements[2][j]);
+			b.rows[1] = Vector3(elements[3][j], elements[4][j], elements[5][j]);
+			b.rows[2] = Vector3(elements[6][j], elements[7][j], elements[8][j]);
+		}
+	}
+	for (; i < p_count; i++) {
+		r_dst[i].set_quaternion(p_src[i]);
+	}
+}
+
 Basis::operator String() const {
 	return "[X: " + get_column(0).operator String() +
 			", Y: " + get_column(1).operator String() +
@@ -30,6 +30,7 @@
 
 #include <godot_cpp/variant/projection.hpp>
 
+#include <godot_cpp/core/simd.hpp>
 #include <godot_cpp/variant/aabb.hpp>
 #include <godot_cpp/variant/plane.hpp>
 #include <godot_cpp/variant/rect2.hpp>
@@ -95,6 +96,77 @@ Vector4 Projection::xform_inv(const Vector4 &p_vec4) const {
 			columns[3][0] * p_vec4.x + columns[3][1] * p_vec4.y + columns[3][2] * p_vec4.z + columns[3][3] * p_vec4.w);
 }
 
+// The SIMD loops evaluate the same expressions as xform(), in the same order, and leave the
+// remainder that doesn't fill a register to it.
+
+void Projection::xform_batch(const Vector3 *p_src, Vector3 *r_dst, size_t p_count) const {
+	using simd::RealV;
+	RealV m[4][4];
+	for (int i = 0; i < 4; i++) {
+		for (int j = 0; j < 4; j++) {
+			m[i][j] = RealV::splat(columns[i][j]);
+		}
+	}
+
+	size_t i = 0;
+	for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+		RealV x, y, z;
+		simd::load3(p_src[i].coord, x, y, z);
+		RealV w = m[0][3] * x + m[1][3] * y + m[2][3] * z + m[3][3];
+		simd::store3(r_dst[i].coord,
+				(m[0][0] * x + m[1][0] * y + m[2][0] * z + m[3][0]) / w,
+				(m[0][1] * x + m[1][1] * y + m[2][1] * z + m[3][1]) / w,
+				(m[0][2] * x + m[1][2] * y + m[2][2] * z + m[3][2]) / w);
+	}
+	for (; i < p_count; i++) {
+		r_dst[i] = xform(p_src[i]);
+	}
+}
+
+void Projection::xform_batch(const Vector4 *p_src, Vector4 *r_dst, size_t p_count) const {
+	using simd::RealV;
+	RealV m[4][4];
+	for (int i = 0; i < 4; i++) {
+		for (int j = 0; j < 4; j++) {
+			m[i][j] = RealV::splat(columns[i][j]);
+		}
+	}
+
+	size_t i = 0;
+	for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+		RealV x, y, z, w;
+		simd::load4(p_src[i].coord, x, y, z, w);
+		simd::store4(r_dst[i].coord,
+				m[0][0] * x + m[1][0] * y + m[2][0] * z + m[3][0] * w,
+				m[0][1] * x + m[1][1] * y + m[2][1] * z + m[3][1] * w,
+				m[0][2] * x + m[1][2] * y + m[2][2] * z + m[3][2] * w,
+				m[0][3] * x + m[1][3] * y + m[2][3] * z + m[3][3] * w);
+	}
+	for (; i < p_count; i++) {
+		r_dst[i] = xform(p_src[i]);
+	}
+}
+
+void Projection::mul_batch(const Projection *p_src, Projection *r_dst, size_t p_count) const {
+	if (p_count == 0) {
+		return;
+	}
+	// Each column of the product is this matrix applied to the matching column of p_src[i].
+	xform_batch(p_src->columns, r_dst->columns, p_count * 4);
+}
+
+void Projection::mul_batch(const Transform3D *p_src, Projection *r_dst, size_t p_count) const {
+	// Converted a few at a time, so the products are taken while the matrices are still in cache.
+	const size_t chunk_size = 16;
+	for (size_t i = 0; i < p_count; i += chunk_size) {
+		size_t chunk = MIN(chunk_size, p_count - i);
+		for (size_t j = 0; j < chunk; j++) {
+			r_dst[i + j] = Projection(p_src[i + j]);
+		}
+		mul_batch(r_dst + i, r_dst + i, chunk);
+	}
+}
+
 void Projection::adjust_perspective_znear(real_t p_new_znear) {
 	real_t zfar = get_z_far();
 	real_t znear = p_new_znear;
@@ -30,6 +30,8 @@
 
 #include <godot_cpp/variant/quaternion.hpp>
 
+#include <godot_cpp/core/math_fast.hpp>
+#include <godot_cpp/core/simd.hpp>
 #include <godot_cpp/variant/basis.hpp>
 #include <godot_cpp/variant/string.hpp>
 
@@ -84,6 +86,22 @@ Quaternion Quaternion::normalized() const {
 	return *this / length();
 }
 
+void Quaternion::normalize_fast() {
+	real_t lengthsq = length_squared();
+	// rsqrt() is only accurate for normal floats, leave zero and tiny quaternions to normalize().
+	if (lengthsq < std::numeric_limits<float>::min()) {
+		normalize();
+		return;
+	}
+	*this *= Math::fast::rsqrt(lengthsq);
+}
+
+Quaternion Quaternion::normalized_fast() const {
+	Quaternion q = *this;
+	q.normalize_fast();
+	return q;
+}
+
 bool Quaternion::is_normalized() const {
 	return Math::is_equal_approx(length_squared(), 1, (real_t)UNIT_EPSILON); //use less epsilon
 }
@@ -112,13 +130,29 @@ Quaternion Quaternion::exp() const {
 	return Quaternion(src_v, theta);
 }
 
+// Shared by slerp() and slerp_batch(), p_cosom is the dot product after adjusting signs.
+static _FORCE_INLINE_ void _slerp_scales(real_t p_cosom, real_t p_weight, real_t &r_scale0, real_t &r_scale1) {
+	if ((1.0f - p_cosom) > (real_t)CMP_EPSILON) {
+		// standard case (slerp)
+		real_t omega = Math::acos(p_cosom);
+		real_t sinom = Math::sin(omega);
+		r_scale0 = Math::sin((1.0 - p_weight) * omega) / sinom;
+		r_scale1 = Math::sin(p_weight * omega) / sinom;
+	} else {
+		// "from" and "to" quaternions are very close
+		//  ... so we can do a linear interpolation
+		r_scale0 = 1.0f - p_weight;
+		r_scale1 = p_weight;
+	}
+}
+
 Quaternion Quaternion::slerp(const Quaternion &p_to, real_t p_weight) const {
 #ifdef MATH_CHECKS
 	ERR_FAIL_COND_V_MSG(!is_normalized(), Quaternion(), "The start quaternion " + operator String() + " must be normalized.");
 	ERR_FAIL_COND_V_MSG(!p_to.is_normalized(), Quaternion(), "The end quaternion " + p_to.operator String() + " must be normalized.");
 #endif
 	Quaternion to1;
-	real_t omega, cosom, sinom, scale0, scale1;
+	real_t cosom, scale0, scale1;
 
 	// calc cosine
 	cosom = dot(p_to);
@@ -132,19 +166,8 @@ Quaternion Quaternion::slerp(const Quaternion &p_to, real_t p_weight) const {
 	}
 
 	// calculate coefficients
+	_slerp_scales(cosom, p_weight, scale0, scale1);
 
-	if ((1.0f - cosom) > (real_t)CMP_EPSILON) {
-		// standard case (slerp)
-		omega = Math::acos(cosom);
-		sinom = Math::sin(omega);
-		scale0 = Math::sin((1.0 - p_weight) * omega) / sinom;
-		scale1 = Math::sin(p_weight * omega) / sinom;
-	} else {
-		// "from" and "to" quaternions are very close
-		//  ... so we can do a linear interpolation
-		scale0 = 1.0f - p_weight;
-		scale1 = p_weight;
-	}
 	// calculate final values
 	return Quaternion(
 			scale0 * x + scale1 * to1.x,
@@ -153,6 +176,110 @@ Quaternion Quaternion::slerp(const Quaternion &p_to, real_t p_weight) const {
 			scale0 * w + scale1 * to1.w);
 }
 
+// Interpolates one register of quaternions, the batch functions run this over copies for the remainder.
+// The sign of p_to is adjusted like in slerp(). With p_correct, the weights are corrected so nlerp follows
+// slerp closely, see "Approximating slerp" by Arseny Kapoulkine (zeux.io, 2015).
+static _FORCE_INLINE_ void _nlerp_block(const Quaternion *p_from, const Quaternion *p_to, const real_t *p_weights, Quaternion *r_dst, bool p_correct) {
+	using simd::RealV;
+	const RealV zero = RealV::splat(0);
+	const RealV one = RealV::splat(1);
+
+	RealV fx, fy, fz, fw, tx, ty, tz, tw;
+	simd::load4(p_from->components, fx, fy, fz, fw);
+	simd::load4(p_to->components, tx, ty, tz, tw);
+	RealV t = RealV::load(p_weights);
+
+	RealV cosom = fx * tx + fy * ty + fz * tz + fw * tw;
+	RealV flip = cmp_lt(cosom, zero) & one;
+	RealV sign = one - (flip + flip);
+	tx = tx * sign;
+	ty = ty * sign;
+	tz = tz * sign;
+	tw = tw * sign;
+
+	if (p_correct) {
+		RealV d = cosom * sign;
+		RealV a = RealV::splat(1.0904f) + d * (RealV::splat(-3.2452f) + d * (RealV::splat(3.55645f) - d * RealV::splat(1.43519f)));
+		RealV b = RealV::splat(0.848013f) + d * (RealV::splat(-1.06021f) + d * RealV::splat(0.215638f));
+		RealV h = t - RealV::splat(0.5f);
+		RealV k = a * h * h + b;
+		t = t + t * h * (t - one) * k;
+	}
+
+	RealV s = one - t;
+	RealV x = s * fx + t * tx;
+	RealV y = s * fy + t * ty;
+	RealV z = s * fz + t * tz;
+	RealV w = s * fw + t * tw;
+	RealV inv_length = one / sqrt(x * x + y * y + z * z + w * w);
+	simd::store4(r_dst->components, x * inv_length, y * inv_length, z * inv_length, w * inv_length);
+}
+
+static void _nlerp_batch(const Quaternion *p_from, const Quaternion *p_to, const real_t *p_weights, Quaternion *r_dst, size_t p_count, bool p_correct) {
+	constexpr int WIDTH = simd::RealV::WIDTH;
+	size_t i = 0;
+	for (; i + WIDTH <= p_count; i += WIDTH) {
+		_nlerp_block(p_from + i, p_to + i, p_weights + i, r_dst + i, p_correct);
+	}
+	if (i < p_count) {
+		Quaternion from[WIDTH], to[WIDTH], dst[WIDTH];
+		real_t weights[WIDTH] = {};
+		for (size_t j = 0; i + j < p_count; j++) {
+			from[j] = p_from[i + j];
+			to[j] = p_to[i + j];
+			weights[j] = p_weights[i + j];
+		}
+		_nlerp_block(from, to, weights, dst, p_correct);
+		for (size_t j = 0; i + j < p_count; j++) {
+			r_dst[i + j] = dst[j];
+		}
+	}
+}
+
+void Quaternion::slerp_batch(const Quaternion *p_from, const Quaternion *p_to, const real_t *p_weights, Quaternion *r_dst, size_t p_count, bool p_approximate) {
+	if (p_approximate) {
+		_nlerp_batch(p_from, p_to, p_weights, r_dst, p_count, true);
+		return;
+	}
+
+	// Same steps as slerp(), only acos() and sin() are evaluated per lane.
+	using simd::RealV;
+	const RealV zero = RealV::splat(0);
+	const RealV one = RealV::splat(1);
+
+	size_t i = 0;
+	for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+		RealV fx, fy, fz, fw, tx, ty, tz, tw;
+		simd::load4(p_from[i].components, fx, fy, fz, fw);
+		simd::load4(p_to[i].components, tx, ty, tz, tw);
+
+		RealV cosom = fx * tx + fy * ty + fz * tz + fw * tw;
+		RealV flip = cmp_lt(cosom, zero) & one;
+		RealV sign = one - (flip + flip);
+
+		real_t lanes_cosom[RealV::WIDTH], lanes_scale0[RealV::WIDTH], lanes_scale1[RealV::WIDTH];
+		(cosom * sign).store(lanes_cosom);
+		for (int j = 0; j < RealV::WIDTH; j++) {
+			_slerp_scales(lanes_cosom[j], p_weights[i + j], lanes_scale0[j], lanes_scale1[j]);
+		}
+		RealV scale0 = RealV::load(lanes_scale0);
+		RealV scale1 = RealV::load(lanes_scale1) * sign;
+
+		simd::store4(r_dst[i].components,
+				scale0 * fx + scale1 * tx,
+				scale0 * fy + scale1 * ty,
+				scale0 * fz + scale1 * tz,
+				scale0 * fw + scale1 * tw);
+	}
+	for (; i < p_count; i++) {
+		r_dst[i] = p_from[i].slerp(p_to[i], p_weights[i]);
+	}
+}
+
+void Quaternion::nlerp_batch(const Quaternion *p_from, const Quaternion *p_to, const real_t *p_weights, Quaternion *r_dst, size_t p_count) {
+	_nlerp_batch(p_from, p_to, p_weights, r_dst, p_count, false);
+}
+
 Quaternion Quaternion::slerpni(const Quaternion &p_to, real_t p_weight) const {
 #ifdef MATH_CHECKS
 	ERR_FAIL_COND_V_MSG(!is_normalized(), Quaternion(), "The start quaternion " + operator String() + " must be normalized.");
@@ -30,6 +30,7 @@
 
 #include <godot_cpp/variant/transform3d.hpp>
 
+#include <godot_cpp/core/simd.hpp>
 #include <godot_cpp/variant/string.hpp>
 
 namespace godot {
@@ -209,6 +210,97 @@ Transform3D Transform3D::operator*(const real_t p_val) const {
 	return ret;
 }
 
+// The SIMD loops evaluate the same expressions as xform() and xform_inv(), in the same order,
+// and leave the remainder that doesn't fill a register to them.
+
+void Transform3D::xform_batch(const Vector3 *p_src, Vector3 *r_dst, size_t p_count) const {
+	using simd::RealV;
+	const RealV m00 = RealV::splat(basis.rows[0].x), m01 = RealV::splat(basis.rows[0].y), m02 = RealV::splat(basis.rows[0].z);
+	const RealV m10 = RealV::splat(basis.rows[1].x), m11 = RealV::splat(basis.rows[1].y), m12 = RealV::splat(basis.rows[1].z);
+	const RealV m20 = RealV::splat(basis.rows[2].x), m21 = RealV::splat(basis.rows[2].y), m22 = RealV::splat(basis.rows[2].z);
+	const RealV ox = RealV::splat(origin.x), oy = RealV::splat(origin.y), oz = RealV::splat(origin.z);
+
+	size_t i = 0;
+	for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+		RealV x, y, z;
+		simd::load3(p_src[i].coord, x, y, z);
+		simd::store3(r_dst[i].coord,
+				m00 * x + m01 * y + m02 * z + ox,
+				m10 * x + m11 * y + m12 * z + oy,
+				m20 * x + m21 * y + m22 * z + oz);
+	}
+	for (; i < p_count; i++) {
+		r_dst[i] = xform(p_src[i]);
+	}
+}
+
+void Transform3D::xform_inv_batch(const Vector3 *p_src, Vector3 *r_dst, size_t p_count) const {
+	using simd::RealV;
+	const RealV m00 = RealV::splat(basis.rows[0].x), m01 = RealV::splat(basis.rows[0].y), m02 = RealV::splat(basis.rows[0].z);
+	const RealV m10 = RealV::splat(basis.rows[1].x), m11 = RealV::splat(basis.rows[1].y), m12 = RealV::splat(basis.rows[1].z);
+	const RealV m20 = RealV::splat(basis.rows[2].x), m21 = RealV::splat(basis.rows[2].y), m22 = RealV::splat(basis.rows[2].z);
+	const RealV ox = RealV::splat(origin.x), oy = RealV::splat(origin.y), oz = RealV::splat(origin.z);
+
+	size_t i = 0;
+	for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+		RealV x, y, z;
+		simd::load3(p_src[i].coord, x, y, z);
+		x = x - ox;
+		y = y - oy;
+		z = z - oz;
+		simd::store3(r_dst[i].coord,
+				m00 * x + m10 * y + m20 * z,
+				m01 * x + m11 * y + m21 * z,
+				m02 * x + m12 * y + m22 * z);
+	}
+	for (; i < p_count; i++) {
+		r_dst[i] = xform_inv(p_src[i]);
+	}
+}
+
+AABB Transform3D::xform_bounds(const Vector3 *p_points, size_t p_count) const {
+	if (p_count == 0) {
+		return AABB();
+	}
+
+	using simd::RealV;
+	Vector3 begin = xform(p_points[0]);
+	Vector3 end = begin;
+
+	size_t i = 1;
+	if (p_count - 1 >= size_t(RealV::WIDTH)) {
+		const RealV m00 = RealV::splat(basis.rows[0].x), m01 = RealV::splat(basis.rows[0].y), m02 = RealV::splat(basis.rows[0].z);
+		const RealV m10 = RealV::splat(basis.rows[1].x), m11 = RealV::splat(basis.rows[1].y), m12 = RealV::splat(basis.rows[1].z);
+		const RealV m20 = RealV::splat(basis.rows[2].x), m21 = RealV::splat(basis.rows[2].y), m22 = RealV::splat(basis.rows[2].z);
+		const RealV ox = RealV::splat(origin.x), oy = RealV::splat(origin.y), oz = RealV::splat(origin.z);
+
+		RealV min_x = RealV::splat(begin.x), min_y = RealV::splat(begin.y), min_z = RealV::splat(begin.z);
+		RealV max_x = min_x, max_y = min_y, max_z = min_z;
+		for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+			RealV x, y, z;
+			simd::load3(p_points[i].coord, x, y, z);
+			RealV tx = m00 * x + m01 * y + m02 * z + ox;
+			RealV ty = m10 * x + m11 * y + m12 * z + oy;
+			RealV tz = m20 * x + m21 * y + m22 * z + oz;
+			min_x = min(min_x, tx);
+			min_y = min(min_y, ty);
+			min_z = min(min_z, tz);
+			max_x = max(max_x, tx);
+			max_y = max(max_y, ty);
+			max_z = max(max_z, tz);
+		}
+		begin = Vector3(simd::reduce_min(min_x), simd::reduce_min(min_y), simd::reduce_min(min_z));
+		end = Vector3(simd::reduce_max(max_x), simd::reduce_max(max_y), simd::reduce_max(max_z));
+	}
+	for (; i < p_count; i++) {
+		Vector3 point = xform(p_points[i]);
+		begin = begin.min(point);
+		end = end.max(point);
+	}
+
+	return AABB(begin, end - begin);
+}
+
 Transform3D::operator String() const {
 	return "[X: " + basis.get_column(0).operator String() +
 			", Y: " + basis.get_column(1).operator String() +
@@ -43,6 +43,67 @@ namespace godot {
 
 GDExtensionVariantFromTypeConstructorFunc Variant::from_type_constructor[Variant::VARIANT_MAX]{};
 GDExtensionTypeFromVariantConstructorFunc Variant::to_type_constructor[Variant::VARIANT_MAX]{};
+bool Variant::inline_pod_enabled = false;
+
+const bool Variant::needs_deinit[Variant::VARIANT_MAX] = {
+	false, // NIL,
+	false, // BOOL,
+	false, // INT,
+	false, // FLOAT,
+	true, // STRING,
+	false, // VECTOR2,
+	false, // VECTOR2I,
+	false, // RECT2,
+	false, // RECT2I,
+	false, // VECTOR3,
+	false, // VECTOR3I,
+	true, // TRANSFORM2D,
+	false, // VECTOR4,
+	false, // VECTOR4I,
+	false, // PLANE,
+	false, // QUATERNION,
+	true, // AABB,
+	true, // BASIS,
+	true, // TRANSFORM3D,
+	true, // PROJECTION,
+
+	// misc types
+	false, // COLOR,
+	true, // STRING_NAME,
+	true, // NODE_PATH,
+	false, // RID,
+	true, // OBJECT,
+	true, // CALLABLE,
+	true, // SIGNAL,
+	true, // DICTIONARY,
+	true, // ARRAY,
+
+	// typed arrays
+	true, // PACKED_BYTE_ARRAY,
+	true, // PACKED_INT32_ARRAY,
+	true, // PACKED_INT64_ARRAY,
+	true, // PACKED_FLOAT32_ARRAY,
+	true, // PACKED_FLOAT64_ARRAY,
+	true, // PACKED_STRING_ARRAY,
+	true, // PACKED_VECTOR2_ARRAY,
+	true, // PACKED_VECTOR3_ARRAY,
+	true, // PACKED_COLOR_ARRAY,
+	true, // PACKED_VECTOR4_ARRAY,
+};
+
+bool Variant::_check_pod_layout(Type p_type, const void *p_value, size_t p_size) {
+	uint8_t engine_variant[GODOT_CPP_VARIANT_SIZE] = {};
+	uint8_t inline_variant[GODOT_CPP_VARIANT_SIZE] = {};
+	from_type_constructor[p_type](engine_variant, const_cast<void *>(p_value));
+	_encode_pod(inline_variant, p_type, p_value, p_size);
+
+	bool valid = memcmp(engine_variant, inline_variant, sizeof(int32_t)) == 0 &&
+			memcmp(engine_variant + DATA_OFFSET, inline_variant + DATA_OFFSET, p_size) == 0 &&
+			internal::gdextension_interface_variant_get_type(inline_variant) == GDExtensionVariantType(p_type);
+
+	internal::gdextension_interface_variant_destroy(engine_variant);
+	return valid;
+}
 
 void Variant::init_bindings() {
 	// Start from 1 to skip NIL.
@@ -70,10 +131,32 @@ void Variant::init_bindings() {
 	PackedVector3Array::init_bindings();
 	PackedVector4Array::init_bindings();
 	PackedColorArray::init_bindings();
+
+	// Encode inline types ourselves only if we produce the same bytes as the engine.
+	auto check = [](Type p_type, const auto &p_value) {
+		return _check_pod_layout(p_type, &p_value, sizeof(p_value));
+	};
+	inline_pod_enabled = check(BOOL, GDExtensionBool(1)) &&
+			check(INT, int64_t(0x0123456789ABCDEF)) &&
+			check(FLOAT, double(-1.5)) &&
+			check(VECTOR2, Vector2(1.5, -2.25)) &&
+			check(VECTOR2I, Vector2i(3, -4)) &&
+			check(RECT2, Rect2(1.5, -2.25, 3.5, 4.75)) &&
+			check(RECT2I, Rect2i(5, -6, 7, 8)) &&
+			check(VECTOR3, Vector3(1.5, -2.25, 3.5)) &&
+			check(VECTOR3I, Vector3i(9, -10, 11)) &&
+			check(VECTOR4, Vector4(1.5, -2.25, 3.5, 4.75)) &&
+			check(VECTOR4I, Vector4i(12, -13, 14, 15)) &&
+			check(PLANE, Plane(0.0, 1.0, 0.0, -2.5)) &&
+			check(QUATERNION, Quaternion(0.5, -0.5, 0.5, 0.5)) &&
+			check(COLOR, Color(0.25, 0.5, 0.75, 1.0)) &&
+			check(RID, uint64_t(0x0000000700000005));
 }
 
 Variant::Variant() {
-	internal::gdextension_interface_variant_new_nil(_native_ptr());
+	if (unlikely(!inline_pod_enabled)) { // Already NIL otherwise, opaque is zeroed.
+		internal::gdextension_interface_variant_new_nil(_native_ptr());
+	}
 }
 
 Variant::Variant(GDExtensionConstVariantPtr native_ptr) {
@@ -81,6 +164,10 @@ Variant::Variant(GDExtensionConstVariantPtr native_ptr) {
 }
 
 Variant::Variant(const Variant &other) {
+	if (likely(inline_pod_enabled) && !needs_deinit[other._get_type_inline()]) {
+		memcpy(opaque, other.opaque, sizeof(opaque));
+		return;
+	}
 	internal::gdextension_interface_variant_new_copy(_native_ptr(), other._native_ptr());
 }
 
@@ -89,18 +176,30 @@ Variant::Variant(Variant &&other) {
 }
 
 Variant::Variant(bool v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	GDExtensionBool encoded;
 	PtrToArg<bool>::encode(v, &encoded);
 	from_type_constructor[BOOL](_native_ptr(), &encoded);
 }
 
 Variant::Variant(int64_t v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	GDExtensionInt encoded;
 	PtrToArg<int64_t>::encode(v, &encoded);
 	from_type_constructor[INT](_native_ptr(), &encoded);
 }
 
 Variant::Variant(double v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	double encoded;
 	PtrToArg<double>::encode(v, &encoded);
 	from_type_constructor[FLOAT](_native_ptr(), &encoded);
@@ -111,26 +210,50 @@ Variant::Variant(const String &v) {
 }
 
 Variant::Variant(const Vector2 &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[VECTOR2](_native_ptr(), (GDExtensionTypePtr)&v);
 }
 
 Variant::Variant(const Vector2i &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[VECTOR2I](_native_ptr(), (GDExtensionTypePtr)&v);
 }
 
 Variant::Variant(const Rect2 &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[RECT2](_native_ptr(), (GDExtensionTypePtr)&v);
 }
 
 Variant::Variant(const Rect2i &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[RECT2I](_native_ptr(), (GDExtensionTypePtr)&v);
 }
 
 Variant::Variant(const Vector3 &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[VECTOR3](_native_ptr(), (GDExtensionTypePtr)&v);
 }
 
 Variant::Variant(const Vector3i &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[VECTOR3I](_native_ptr(), (GDExtensionTypePtr)&v);
 }
 
@@ -139,18 +262,34 @@ Variant::Variant(const Transform2D &v) {
 }
 
 Variant::Variant(const Vector4 &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[VECTOR4](_native_ptr(), (GDExtensionTypePtr)&v);
 }
 
 Variant::Variant(const Vector4i &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[VECTOR4I](_native_ptr(), (GDExtensionTypePtr)&v);
 }
 
 Variant::Variant(const Plane &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[PLANE](_native_ptr(), (GDExtensionTypePtr)&v);
 }
 
 Variant::Variant(const Quaternion &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[QUATERNION](_native_ptr(), (GDExtensionTypePtr)&v);
 }
 
@@ -171,6 +310,10 @@ Variant::Variant(const Projection &v) {
 }
 
 Variant::Variant(const Color &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[COLOR](_native_ptr(), (GDExtensionTypePtr)&v);
 }
 
@@ -183,6 +326,10 @@ Variant::Variant(const NodePath &v) {
 }
 
 Variant::Variant(const godot::RID &v) {
+	if (likely(inline_pod_enabled)) {
+		_init_pod(v);
+		return;
+	}
 	from_type_constructor[RID](_native_ptr(), v._native_ptr());
 }
 
@@ -256,6 +403,9 @@ Variant::Variant(const PackedVector4Array &v) {
 }
 
 Variant::~Variant() {
+	if (likely(inline_pod_enabled) && !needs_deinit[_get_type_inline()]) {
+		return;
+	}
 	internal::gdextension_interface_variant_destroy(_native_ptr());
 }
 
@@ -518,6 +668,10 @@ Object *Variant::get_validated_object() const {
 
 Variant &Variant::operator=(const Variant &other) {
 	clear();
+	if (likely(inline_pod_enabled) && !needs_deinit[other._get_type_inline()]) {
+		memcpy(opaque, other.opaque, sizeof(opaque));
+		return *this;
+	}
 	internal::gdextension_interface_variant_new_copy(_native_ptr(), other._native_ptr());
 	return *this;
 }
@@ -667,6 +821,9 @@ Variant Variant::iter_get(const Variant &r_iter, bool &r_valid) const {
 }
 
 Variant::Type Variant::get_type() const {
+	if (likely(inline_pod_enabled)) {
+		return _get_type_inline();
+	}
 	return static_cast<Variant::Type>(internal::gdextension_interface_variant_get_type(_native_ptr()));
 }
 
@@ -740,50 +897,13 @@ bool Variant::can_convert_strict(Variant::Type from, Variant::Type to) {
 }
 
 void Variant::clear() {
-	static const bool needs_deinit[Variant::VARIANT_MAX] = {
-		false, // NIL,
-		false, // BOOL,
-		false, // INT,
-		false, // FLOAT,
-		true, // STRING,
-		false, // VECTOR2,
-		false, // VECTOR2I,
-		false, // RECT2,
-		false, // RECT2I,
-		false, // VECTOR3,
-		false, // VECTOR3I,
-		true, // TRANSFORM2D,
-		false, // VECTOR4,
-		false, // VECTOR4I,
-		false, // PLANE,
-		false, // QUATERNION,
-		true, // AABB,
-		true, // BASIS,
-		true, // TRANSFORM3D,
-		true, // PROJECTION,
-
-		// misc types
-		false, // COLOR,
-		true, // STRING_NAME,
-		true, // NODE_PATH,
-		false, // RID,
-		true, // OBJECT,
-		true, // CALLABLE,
-		true, // SIGNAL,
-		true, // DICTIONARY,
-		true, // ARRAY,
-
-		// typed arrays
-		true, // PACKED_BYTE_ARRAY,
-		true, // PACKED_INT32_ARRAY,
-		true, // PACKED_INT64_ARRAY,
-		true, // PACKED_FLOAT32_ARRAY,
-		true, // PACKED_FLOAT64_ARRAY,
-		true, // PACKED_STRING_ARRAY,
-		true, // PACKED_VECTOR2_ARRAY,
-		true, // PACKED_VECTOR3_ARRAY,
-		true, // PACKED_COLOR_ARRAY,
-	};
+	if (likely(inline_pod_enabled)) {
+		if (unlikely(needs_deinit[_get_type_inline()])) { // Make it fast for types that don't need deinit.
+			internal::gdextension_interface_variant_destroy(_native_ptr());
+		}
+		memset(opaque, 0, sizeof(opaque));
+		return;
+	}
 
 	if (unlikely(needs_deinit[get_type()])) { // Make it fast for types that don't need deinit.
 		internal::gdextension_interface_variant_destroy(_native_ptr());
@@ -791,4 +911,18 @@ void Variant::clear() {
 	internal::gdextension_interface_variant_new_nil(_native_ptr());
 }
 
+void Variant::destroy_batch(Variant *p_variants, size_t p_count) {
+	if (likely(inline_pod_enabled)) {
+		for (size_t i = 0; i < p_count; i++) {
+			if (unlikely(needs_deinit[p_variants[i]._get_type_inline()])) {
+				internal::gdextension_interface_variant_destroy(p_variants[i]._native_ptr());
+			}
+		}
+		return;
+	}
+	for (size_t i = 0; i < p_count; i++) {
+		internal::gdextension_interface_variant_destroy(p_variants[i]._native_ptr());
+	}
+}
+
 } // namespace godot
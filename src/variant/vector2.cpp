@@ -30,6 +30,7 @@
 
 #include <godot_cpp/variant/vector2.hpp>
 
+#include <godot_cpp/core/math_fast.hpp>
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/vector2i.hpp>
 
@@ -66,6 +67,24 @@ Vector2 Vector2::normalized() const {
 	return v;
 }
 
+void Vector2::normalize_fast() {
+	real_t l = x * x + y * y;
+	// rsqrt() is only accurate for normal floats, leave zero and tiny vectors to normalize().
+	if (l < std::numeric_limits<float>::min()) {
+		normalize();
+		return;
+	}
+	l = Math::fast::rsqrt(l);
+	x *= l;
+	y *= l;
+}
+
+Vector2 Vector2::normalized_fast() const {
+	Vector2 v = *this;
+	v.normalize_fast();
+	return v;
+}
+
 bool Vector2::is_normalized() const {
 	// use length_squared() instead of length() to avoid sqrt(), makes it more stringent.
 	return Math::is_equal_approx(length_squared(), 1, (real_t)UNIT_EPSILON);
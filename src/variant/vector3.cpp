@@ -30,6 +30,7 @@
 
 #include <godot_cpp/variant/vector3.hpp>
 
+#include <godot_cpp/core/math_fast.hpp>
 #include <godot_cpp/variant/basis.hpp>
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/vector2.hpp>
@@ -85,6 +86,25 @@ Vector3 Vector3::snappedf(real_t p_step) const {
 	return v;
 }
 
+void Vector3::normalize_fast() {
+	real_t lengthsq = length_squared();
+	// rsqrt() is only accurate for normal floats, leave zero and tiny vectors to normalize().
+	if (lengthsq < std::numeric_limits<float>::min()) {
+		normalize();
+		return;
+	}
+	real_t inv_length = Math::fast::rsqrt(lengthsq);
+	x *= inv_length;
+	y *= inv_length;
+	z *= inv_length;
+}
+
+Vector3 Vector3::normalized_fast() const {
+	Vector3 v = *this;
+	v.normalize_fast();
+	return v;
+}
+
 Vector3 Vector3::limit_length(const real_t p_len) const {
 	const real_t l = length();
 	Vector3 v = *this;
@@ -30,6 +30,7 @@
 
 #include <godot_cpp/variant/vector4.hpp>
 
+#include <godot_cpp/core/math_fast.hpp>
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/vector4i.hpp>
 
@@ -94,6 +95,26 @@ Vector4 Vector4::normalized() const {
 	return v;
 }
 
+void Vector4::normalize_fast() {
+	real_t lengthsq = length_squared();
+	// rsqrt() is only accurate for normal floats, leave zero and tiny vectors to normalize().
+	if (lengthsq < std::numeric_limits<float>::min()) {
+		normalize();
+		return;
+	}
+	real_t inv_length = Math::fast::rsqrt(lengthsq);
+	x *= inv_length;
+	y *= inv_length;
+	z *= inv_length;
+	w *= inv_length;
+}
+
+Vector4 Vector4::normalized_fast() const {
+	Vector4 v = *this;
+	v.normalize_fast();
+	return v;
+}
+
 bool Vector4::is_normalized() const {
 	return Math::is_equal_approx(length_squared(), (real_t)1, (real_t)UNIT_EPSILON);
 }
@@ -0,0 +1,327 @@
+/**************************************************************************/
+/*  vector_stream.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include <godot_cpp/variant/vector_stream.hpp>
+
+#include <godot_cpp/core/simd.hpp>
+
+#include <type_traits>
+
+namespace godot {
+
+namespace simd {
+
+static_assert(sizeof(Vector2) == 2 * sizeof(real_t) && sizeof(Vector3) == 3 * sizeof(real_t) && sizeof(Vector4) == 4 * sizeof(real_t));
+
+// Loads and stores RealV::WIDTH vectors as one register per component.
+template <typename V>
+struct _Lanes;
+
+template <>
+struct _Lanes<Vector2> {
+	static constexpr int N = 2;
+	_ALWAYS_INLINE_ static void load(const Vector2 *p_src, RealV *r_c) { load2(p_src->coord, r_c[0], r_c[1]); }
+	_ALWAYS_INLINE_ static void store(Vector2 *p_dst, const RealV *p_c) { store2(p_dst->coord, p_c[0], p_c[1]); }
+};
+
+template <>
+struct _Lanes<Vector3> {
+	static constexpr int N = 3;
+	_ALWAYS_INLINE_ static void load(const Vector3 *p_src, RealV *r_c) { load3(p_src->coord, r_c[0], r_c[1], r_c[2]); }
+	_ALWAYS_INLINE_ static void store(Vector3 *p_dst, const RealV *p_c) { store3(p_dst->coord, p_c[0], p_c[1], p_c[2]); }
+};
+
+template <>
+struct _Lanes<Vector4> {
+	static constexpr int N = 4;
+	_ALWAYS_INLINE_ static void load(const Vector4 *p_src, RealV *r_c) { load4(p_src->coord, r_c[0], r_c[1], r_c[2], r_c[3]); }
+	_ALWAYS_INLINE_ static void store(Vector4 *p_dst, const RealV *p_c) { store4(p_dst->coord, p_c[0], p_c[1], p_c[2], p_c[3]); }
+};
+
+template <typename T>
+_ALWAYS_INLINE_ T _broadcast(real_t p_value) {
+	if constexpr (std::is_same_v<T, RealV>) {
+		return RealV::splat(p_value);
+	} else {
+		return p_value;
+	}
+}
+
+_ALWAYS_INLINE_ real_t fmadd(real_t p_a, real_t p_b, real_t p_c) {
+	return p_a * p_b + p_c;
+}
+
+// Component-wise operations don't care where one vector ends and the next begins, so they
+// run over the flat real_t array. p_op is called with RealV for full registers and with
+// real_t for the remainder.
+template <typename V, typename F>
+static void _map_flat(uint64_t p_count, V *r_dst, F p_op, const V *p_a, const V *p_b = nullptr, const V *p_c = nullptr) {
+	if (p_count == 0) {
+		return;
+	}
+
+	const real_t *a = p_a->coord;
+	const real_t *b = p_b ? p_b->coord : a;
+	const real_t *c = p_c ? p_c->coord : a;
+	real_t *dst = r_dst->coord;
+	const uint64_t n = p_count * _Lanes<V>::N;
+
+	uint64_t i = 0;
+	for (; i + RealV::WIDTH <= n; i += RealV::WIDTH) {
+		p_op(RealV::load(a + i), RealV::load(b + i), RealV::load(c + i)).store(dst + i);
+	}
+	for (; i < n; i++) {
+		dst[i] = p_op(a[i], b[i], c[i]);
+	}
+}
+
+template <typename V>
+static void _dot(const V *p_a, const V *p_b, real_t *r_dst, uint64_t p_count) {
+	constexpr int N = _Lanes<V>::N;
+	uint64_t i = 0;
+	for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+		// Multiplying before deinterleaving leaves one shuffle instead of two.
+		real_t products[N * RealV::WIDTH];
+		for (int j = 0; j < N; j++) {
+			(RealV::load(p_a[i].coord + j * RealV::WIDTH) * RealV::load(p_b[i].coord + j * RealV::WIDTH)).store(products + j * RealV::WIDTH);
+		}
+		RealV p[N];
+		_Lanes<V>::load(reinterpret_cast<const V *>(products), p);
+		RealV d = p[0];
+		for (int k = 1; k < N; k++) {
+			d = d + p[k];
+		}
+		d.store(r_dst + i);
+	}
+	for (; i < p_count; i++) {
+		r_dst[i] = p_a[i].dot(p_b[i]);
+	}
+}
+
+template <typename V>
+static void _length(const V *p_a, real_t *r_dst, uint64_t p_count) {
+	constexpr int N = _Lanes<V>::N;
+	uint64_t i = 0;
+	for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+		RealV a[N];
+		_Lanes<V>::load(p_a + i, a);
+		RealV lengthsq = a[0] * a[0];
+		for (int k = 1; k < N; k++) {
+			lengthsq = lengthsq + a[k] * a[k];
+		}
+		sqrt(lengthsq).store(r_dst + i);
+	}
+	for (; i < p_count; i++) {
+		r_dst[i] = p_a[i].length();
+	}
+}
+
+template <typename V>
+static void _normalize(const V *p_a, V *r_dst, uint64_t p_count) {
+	constexpr int N = _Lanes<V>::N;
+	const RealV zero = RealV::splat(0);
+	uint64_t i = 0;
+	for (; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+		RealV a[N];
+		_Lanes<V>::load(p_a + i, a);
+		RealV lengthsq = a[0] * a[0];
+		for (int k = 1; k < N; k++) {
+			lengthsq = lengthsq + a[k] * a[k];
+		}
+		RealV length = sqrt(lengthsq);
+		RealV nonzero = cmp_gt(lengthsq, zero);
+		for (int k = 0; k < N; k++) {
+			if constexpr (std::is_same_v<V, Vector2>) {
+				// Vector2::normalize() leaves vectors whose squared length underflows to zero untouched.
+				a[k] = ((a[k] / length) & nonzero) | (a[k] & cmp_le(lengthsq, zero));
+			} else {
+				a[k] = (a[k] / length) & nonzero;
+			}
+		}
+		_Lanes<V>::store(r_dst + i, a);
+	}
+	for (; i < p_count; i++) {
+		r_dst[i] = p_a[i].normalized();
+	}
+}
+
+// Register j of every block of RealV::WIDTH vectors always holds the same components, so
+// the accumulators stay in flat order and are only sorted out by component at the end.
+template <typename V, bool FIND_MIN, bool FIND_MAX>
+static void _min_max(const V *p_a, uint64_t p_count, V &r_min, V &r_max) {
+	constexpr int N = _Lanes<V>::N;
+	if (p_count == 0) {
+		r_min = V();
+		r_max = V();
+		return;
+	}
+
+	V vmin = p_a[0];
+	V vmax = p_a[0];
+	uint64_t i = 0;
+	if (p_count >= uint64_t(RealV::WIDTH)) {
+		RealV lo[N], hi[N];
+		for (int j = 0; j < N; j++) {
+			lo[j] = RealV::load(p_a->coord + j * RealV::WIDTH);
+			hi[j] = lo[j];
+		}
+		for (i = RealV::WIDTH; i + RealV::WIDTH <= p_count; i += RealV::WIDTH) {
+			const real_t *src = p_a[i].coord;
+			for (int j = 0; j < N; j++) {
+				RealV a = RealV::load(src + j * RealV::WIDTH);
+				if constexpr (FIND_MIN) {
+					lo[j] = min(lo[j], a);
+				}
+				if constexpr (FIND_MAX) {
+					hi[j] = max(hi[j], a);
+				}
+			}
+		}
+
+		real_t lanes_lo[N * RealV::WIDTH], lanes_hi[N * RealV::WIDTH];
+		for (int j = 0; j < N; j++) {
+			lo[j].store(lanes_lo + j * RealV::WIDTH);
+			hi[j].store(lanes_hi + j * RealV::WIDTH);
+		}
+		for (int k = 0; k < N * RealV::WIDTH; k++) {
+			vmin.coord[k % N] = MIN(vmin.coord[k % N], lanes_lo[k]);
+			vmax.coord[k % N] = MAX(vmax.coord[k % N], lanes_hi[k]);
+		}
+	}
+	for (; i < p_count; i++) {
+		if constexpr (FIND_MIN) {
+			vmin = vmin.min(p_a[i]);
+		}
+		if constexpr (FIND_MAX) {
+			vmax = vmax.max(p_a[i]);
+		}
+	}
+	r_min = vmin;
+	r_max = vmax;
+}
+
+#define STREAM_BINARY_OP(m_name, m_type, m_expr)                                                               \
+	void m_name(Span<const m_type> p_a, Span<const m_type> p_b, Span<m_type> r_dst) {                          \
+		ERR_FAIL_COND(p_b.size() != p_a.size() || r_dst.size() != p_a.size());                                 \
+		_map_flat(p_a.size(), r_dst.ptr(), [](auto a, auto b, auto) { return m_expr; }, p_a.ptr(), p_b.ptr()); \
+	}
+
+#define STREAM_OPS(m_type)                                                                                                                                               \
+	STREAM_BINARY_OP(add, m_type, a + b)                                                                                                                                 \
+	STREAM_BINARY_OP(sub, m_type, a - b)                                                                                                                                 \
+	STREAM_BINARY_OP(mul, m_type, a * b)                                                                                                                                 \
+	void mul(Span<const m_type> p_a, real_t p_scalar, Span<m_type> r_dst) {                                                                                              \
+		ERR_FAIL_COND(r_dst.size() != p_a.size());                                                                                                                       \
+		_map_flat(p_a.size(), r_dst.ptr(), [p_scalar](auto a, auto, auto) { return a * _broadcast<decltype(a)>(p_scalar); }, p_a.ptr());                                 \
+	}                                                                                                                                                                    \
+	void fma(Span<const m_type> p_a, Span<const m_type> p_b, Span<const m_type> p_c, Span<m_type> r_dst) {                                                               \
+		ERR_FAIL_COND(p_b.size() != p_a.size() || p_c.size() != p_a.size() || r_dst.size() != p_a.size());                                                               \
+		_map_flat(p_a.size(), r_dst.ptr(), [](auto a, auto b, auto c) { return fmadd(a, b, c); }, p_a.ptr(), p_b.ptr(), p_c.ptr());                                      \
+	}                                                                                                                                                                    \
+	void lerp(Span<const m_type> p_from, Span<const m_type> p_to, real_t p_weight, Span<m_type> r_dst) {                                                                 \
+		ERR_FAIL_COND(p_to.size() != p_from.size() || r_dst.size() != p_from.size());                                                                                    \
+		_map_flat(p_from.size(), r_dst.ptr(), [p_weight](auto a, auto b, auto) { return a + (_broadcast<decltype(a)>(p_weight) * (b - a)); }, p_from.ptr(), p_to.ptr()); \
+	}                                                                                                                                                                    \
+	void dot(Span<const m_type> p_a, Span<const m_type> p_b, Span<real_t> r_dst) {                                                                                       \
+		ERR_FAIL_COND(p_b.size() != p_a.size() || r_dst.size() != p_a.size());                                                                                           \
+		_dot(p_a.ptr(), p_b.ptr(), r_dst.ptr(), p_a.size());                                                                                                             \
+	}                                                                                                                                                                    \
+	void length(Span<const m_type> p_a, Span<real_t> r_dst) {                                                                                                            \
+		ERR_FAIL_COND(r_dst.size() != p_a.size());                                                                                                                       \
+		_length(p_a.ptr(), r_dst.ptr(), p_a.size());                                                                                                                     \
+	}                                                                                                                                                                    \
+	void normalize(Span<const m_type> p_a, Span<m_type> r_dst) {                                                                                                         \
+		ERR_FAIL_COND(r_dst.size() != p_a.size());                                                                                                                       \
+		_normalize(p_a.ptr(), r_dst.ptr(), p_a.size());                                                                                                                  \
+	}                                                                                                                                                                    \
+	m_type reduce_min(Span<const m_type> p_a) {                                                                                                                          \
+		m_type vmin, vmax;                                                                                                                                               \
+		_min_max<m_type, true, false>(p_a.ptr(), p_a.size(), vmin, vmax);                                                                                                \
+		return vmin;                                                                                                                                                     \
+	}                                                                                                                                                                    \
+	m_type reduce_max(Span<const m_type> p_a) {                                                                                                                          \
+		m_type vmin, vmax;                                                                                                                                               \
+		_min_max<m_type, false, true>(p_a.ptr(), p_a.size(), vmin, vmax);                                                                                                \
+		return vmax;                                                                                                                                                     \
+	}
+
+STREAM_OPS(Vector2)
+STREAM_OPS(Vector3)
+STREAM_OPS(Vector4)
+
+#undef STREAM_OPS
+#undef STREAM_BINARY_OP
+
+void cross(Span<const Vector2> p_a, Span<const Vector2> p_b, Span<real_t> r_dst) {
+	ERR_FAIL_COND(p_b.size() != p_a.size() || r_dst.size() != p_a.size());
+	uint64_t i = 0;
+	for (; i + RealV::WIDTH <= p_a.size(); i += RealV::WIDTH) {
+		RealV ax, ay, bx, by;
+		load2(p_a[i].coord, ax, ay);
+		load2(p_b[i].coord, bx, by);
+		(ax * by - ay * bx).store(r_dst.ptr() + i);
+	}
+	for (; i < p_a.size(); i++) {
+		r_dst[i] = p_a[i].cross(p_b[i]);
+	}
+}
+
+void cross(Span<const Vector3> p_a, Span<const Vector3> p_b, Span<Vector3> r_dst) {
+	ERR_FAIL_COND(p_b.size() != p_a.size() || r_dst.size() != p_a.size());
+	uint64_t i = 0;
+	for (; i + RealV::WIDTH <= p_a.size(); i += RealV::WIDTH) {
+		RealV ax, ay, az, bx, by, bz;
+		load3(p_a[i].coord, ax, ay, az);
+		load3(p_b[i].coord, bx, by, bz);
+		store3(r_dst[i].coord,
+				(ay * bz) - (az * by),
+				(az * bx) - (ax * bz),
+				(ax * by) - (ay * bx));
+	}
+	for (; i < p_a.size(); i++) {
+		r_dst[i] = p_a[i].cross(p_b[i]);
+	}
+}
+
+Rect2 bounds(Span<const Vector2> p_points) {
+	Vector2 begin, end;
+	_min_max<Vector2, true, true>(p_points.ptr(), p_points.size(), begin, end);
+	return Rect2(begin, end - begin);
+}
+
+AABB bounds(Span<const Vector3> p_points) {
+	Vector3 begin, end;
+	_min_max<Vector3, true, true>(p_points.ptr(), p_points.size(), begin, end);
+	return AABB(begin, end - begin);
+}
+
+} // namespace simd
+
+} // namespace godot
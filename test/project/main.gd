@@ -168,6 +168,115 @@ func _ready():
 	assert_equal(example.test_vector_ops(), 105)
 	assert_equal(example.test_vector_init_list(), 105)
 
+	# Batch transforms.
+	assert_equal(example.test_xform_batch(), true)
+	assert_equal(example.test_aabb_batch(), true)
+	assert_equal(example.test_math_fast(), true)
+
+	# Vector streams, each operation against its scalar version.
+	var stream_result = example.test_vector_stream()
+	assert_equal(stream_result["normalize_wrong"], 0)
+	assert_equal(stream_result["cross_wrong"], 0)
+	assert_equal(stream_result["dot_wrong"], 0)
+	assert_equal(stream_result["lerp_wrong"], 0)
+	assert_equal(stream_result["add_wrong"], 0)
+	assert_equal(stream_result["sub_wrong"], 0)
+	assert_equal(stream_result["mul_wrong"], 0)
+	assert_equal(stream_result["mul_scalar_wrong"], 0)
+	assert_equal(stream_result["fma_wrong"], 0)
+	assert_equal(stream_result["length_wrong"], 0)
+	assert_equal(stream_result["bounds_matches"], true)
+	assert_equal(stream_result["reduce_max_matches"], true)
+
+	# Quaternion batches.
+	var quaternion_result = example.test_quaternion_batch()
+	assert_equal(quaternion_result["slerp_wrong"], 0)
+	assert_equal(quaternion_result["approximate_wrong"], 0)
+	assert_equal(quaternion_result["nlerp_wrong"], 0)
+	assert_equal(quaternion_result["basis_wrong"], 0)
+
+	# Projection batches.
+	var projection_result = example.test_projection_batch()
+	assert_equal(projection_result["point_wrong"], 0)
+	assert_equal(projection_result["vector_wrong"], 0)
+	assert_equal(projection_result["product_wrong"], 0)
+	assert_equal(projection_result["transform_product_wrong"], 0)
+	assert_equal(projection_result["in_place_wrong"], 0)
+
+	# Work stealing pool, nested groups.
+	var pool_result = example.test_work_stealing_pool()
+	assert_equal(pool_result["do_work_wrong"], 0)
+	assert_equal(pool_result["begin_work_wrong"], 0)
+	assert_true(pool_result["threads"] > 1)
+
+	# Arena and FrameArena.
+	var arena_result = example.test_arena()
+	assert_equal(arena_result["misaligned"], 0)
+	assert_equal(arena_result["overwritten"], 0)
+	assert_equal(arena_result["grew"], true)
+	assert_equal(arena_result["reset_to_used"], true)
+	assert_equal(arena_result["reused"], true)
+	assert_equal(arena_result["reset_used"], 0)
+	assert_equal(arena_result["reset_reserved"], true)
+	assert_equal(arena_result["freed_reserved"], 0)
+	assert_equal(arena_result["alloc_after_free"], true)
+	assert_equal(arena_result["frame_containers_sum"], 1497500)
+	assert_equal(arena_result["frame_used"], true)
+	assert_equal(arena_result["frame_released"], true)
+
+	# Memory pool, freed from another thread.
+	var pool_memory_result = example.test_memory_pool()
+	assert_equal(pool_memory_result["misaligned"], 0)
+	assert_equal(pool_memory_result["overlapping"], 0)
+	assert_equal(pool_memory_result["reserved"], true)
+	assert_equal(pool_memory_result["released"], true)
+	assert_equal(pool_memory_result["alloc_after_release"], true)
+	assert_equal(pool_memory_result["live_block_kept"], true)
+	assert_equal(pool_memory_result["second_release_restored"], true)
+
+	# FlatHashMap and FlatHashSet.
+	var flat_result = example.test_flat_hash_map()
+	assert_equal(flat_result["size"], 1000)
+	assert_equal(flat_result["missing"], 0)
+	assert_equal(flat_result["size_after_erase"], 500)
+	assert_equal(flat_result["wrong_after_erase"], 0)
+	assert_equal(flat_result["forward_count"], 500)
+	assert_equal(flat_result["backward_count"], 500)
+	assert_equal(flat_result["backward_mismatches"], 0)
+	assert_equal(flat_result["copy_independent"], true)
+	assert_equal(flat_result["moved_size"], 499)
+	assert_equal(flat_result["moved_from_size"], 0)
+	assert_equal(flat_result["chain_wrong"], 0)
+	assert_equal(flat_result["visited_while_removing"], true)
+	assert_equal(flat_result["wrong_after_remove"], 0)
+	assert_equal(flat_result["reserve_kept_capacity"], true)
+	assert_equal(flat_result["window_wrong"], 0)
+	assert_equal(flat_result["window_kept_capacity"], true)
+	assert_equal(flat_result["set_wrong"], 0)
+	assert_equal(flat_result["set_sum"], 1750000)
+
+	# Thread-safe RID_Owner.
+	var rid_result = example.test_rid_owner()
+	assert_equal(rid_result["stable_wrong"], 0)
+	assert_equal(rid_result["own_wrong"], 0)
+	assert_equal(rid_result["freed_wrong"], 0)
+	assert_equal(rid_result["count"], 8064)
+	assert_equal(rid_result["kept_wrong"], 0)
+	assert_equal(rid_result["count_after_free"], 0)
+
+	# Interned StringName literals.
+	var sname_result = example.test_string_name_literal()
+	assert_equal(sname_result["same_object"], true)
+	assert_equal(sname_result["same_name"], true)
+	assert_equal(sname_result["hash_matches"], true)
+
+	# Variant batches.
+	var variant_batch_result = example.test_variant_batch()
+	assert_equal(variant_batch_result["bool_wrong"], 0)
+	assert_equal(variant_batch_result["int_wrong"], 0)
+	assert_equal(variant_batch_result["float_wrong"], 0)
+	assert_equal(variant_batch_result["vector3_wrong"], 0)
+
 	# Properties.
 	assert_equal(example.group_subgroup_custom_position, Vector2(0, 0))
 	example.group_subgroup_custom_position = Vector2(50, 50)
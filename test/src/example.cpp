@@ -12,9 +12,25 @@
 #include <godot_cpp/classes/multiplayer_api.hpp>
 #include <godot_cpp/classes/multiplayer_peer.hpp>
 #include <godot_cpp/classes/os.hpp>
+#include <godot_cpp/core/math_fast.hpp>
+#include <godot_cpp/templates/arena.hpp>
+#include <godot_cpp/templates/flat_hash_map.hpp>
+#include <godot_cpp/templates/flat_hash_set.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/list.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/templates/rid_owner.hpp>
+#include <godot_cpp/templates/work_stealing_pool.hpp>
+#include <godot_cpp/variant/aabb_batch.hpp>
+#include <godot_cpp/variant/string_name_literal.hpp>
 #include <godot_cpp/variant/typed_dictionary.hpp>
+#include <godot_cpp/variant/vector_stream.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include <chrono>
+#include <cstring>
+#include <thread>
+
 using namespace godot;
 
 class MyCallableCustom : public CallableCustom {
@@ -77,8 +93,8 @@ void ExampleRef::_notification(int p_what) {
 }
 
 void ExampleRef::_bind_methods() {
-	ClassDB::bind_method(D_METHOD("set_id", "id"), &ExampleRef::set_id);
-	ClassDB::bind_method(D_METHOD("get_id"), &ExampleRef::get_id);
+	ClassDB::bind_method<&ExampleRef::set_id>(D_METHOD("set_id", "id"));
+	ClassDB::bind_method<&ExampleRef::get_id>(D_METHOD("get_id"));
 
 	ClassDB::bind_method(D_METHOD("was_post_initialized"), &ExampleRef::was_post_initialized);
 
@@ -210,6 +226,20 @@ void Example::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("test_typed_array_of_packed"), &Example::test_typed_array_of_packed);
 	ClassDB::bind_method(D_METHOD("test_vector_ops"), &Example::test_vector_ops);
 	ClassDB::bind_method(D_METHOD("test_vector_init_list"), &Example::test_vector_init_list);
+	ClassDB::bind_method(D_METHOD("test_xform_batch"), &Example::test_xform_batch);
+	ClassDB::bind_method(D_METHOD("test_aabb_batch"), &Example::test_aabb_batch);
+	ClassDB::bind_method(D_METHOD("test_vector_stream"), &Example::test_vector_stream);
+	ClassDB::bind_method(D_METHOD("test_quaternion_batch"), &Example::test_quaternion_batch);
+	ClassDB::bind_method(D_METHOD("test_projection_batch"), &Example::test_projection_batch);
+	ClassDB::bind_method(D_METHOD("test_math_fast"), &Example::test_math_fast);
+
+	ClassDB::bind_method(D_METHOD("test_work_stealing_pool"), &Example::test_work_stealing_pool);
+	ClassDB::bind_method(D_METHOD("test_arena"), &Example::test_arena);
+	ClassDB::bind_method(D_METHOD("test_memory_pool"), &Example::test_memory_pool);
+	ClassDB::bind_method(D_METHOD("test_flat_hash_map"), &Example::test_flat_hash_map);
+	ClassDB::bind_method(D_METHOD("test_rid_owner"), &Example::test_rid_owner);
+	ClassDB::bind_method(D_METHOD("test_string_name_literal"), &Example::test_string_name_literal);
+	ClassDB::bind_method(D_METHOD("test_variant_batch"), &Example::test_variant_batch);
 
 	ClassDB::bind_method(D_METHOD("test_object_cast_to_node", "object"), &Example::test_object_cast_to_node);
 	ClassDB::bind_method(D_METHOD("test_object_cast_to_control", "object"), &Example::test_object_cast_to_control);
@@ -468,6 +498,767 @@ int Example::test_vector_init_list() const {
 	return ret;
 }
 
+bool Example::test_xform_batch() const {
+	Transform3D t(Basis(Vector3(1, 2, 3).normalized(), 0.5).scaled(Vector3(2, 1, 0.5)), Vector3(10, -4, 7));
+
+	// An odd count, so the scalar remainder is exercised too.
+	PackedVector3Array points;
+	for (int i = 0; i < 37; i++) {
+		points.push_back(Vector3(i * 0.5f, -i * 1.5f, i % 7));
+	}
+
+	PackedVector3Array xformed = t.xform(points);
+	PackedVector3Array xformed_inv = t.xform_inv(points);
+	PackedVector3Array basis_xformed;
+	basis_xformed.resize(points.size());
+	t.basis.xform_batch(points.ptr(), basis_xformed.ptrw(), points.size());
+
+	AABB bounds(t.xform(points[0]), Vector3());
+	for (int i = 0; i < points.size(); i++) {
+		if (!xformed[i].is_equal_approx(t.xform(points[i])) ||
+				!xformed_inv[i].is_equal_approx(t.xform_inv(points[i])) ||
+				!basis_xformed[i].is_equal_approx(t.basis.xform(points[i]))) {
+			return false;
+		}
+		bounds.expand_to(xformed[i]);
+	}
+
+	AABB batch_bounds = t.xform_bounds(points.ptr(), points.size());
+	return batch_bounds.position.is_equal_approx(bounds.position) && batch_bounds.size.is_equal_approx(bounds.size);
+}
+
+bool Example::test_aabb_batch() const {
+	// A grid of boxes around the camera, some in view, some behind it and some out of range.
+	AABBBatch batch;
+	for (int x = -5; x <= 5; x++) {
+		for (int z = -5; z <= 5; z++) {
+			batch.push_back(AABB(Vector3(x * 8, (x + z) % 3, z * 8), Vector3(1 + (x & 1), 2, 1 + (z & 1))));
+		}
+	}
+	batch.remove_at_unordered(17);
+
+	Projection projection = Projection::create_perspective(70, 16.0 / 9.0, 0.1, 30);
+	Transform3D camera = Transform3D().looking_at(Vector3(1, 0, -1));
+	Array planes_array = projection.get_projection_planes(camera);
+	Plane planes[6];
+	for (int i = 0; i < 6; i++) {
+		planes[i] = planes_array[i];
+	}
+	Vector3 points[8];
+	projection.get_endpoints(camera, points);
+
+	AABB query(Vector3(-10, -1, -10), Vector3(15, 2, 12));
+	Vector3 ray_from(-40, 1, 3);
+	Vector3 ray_dir(1, 0, 0.1);
+
+	LocalVector<uint64_t> culled, overlaps, hits;
+	culled.resize(batch.get_mask_size());
+	overlaps.resize(batch.get_mask_size());
+	hits.resize(batch.get_mask_size());
+	batch.cull(projection, camera, culled.ptr());
+	batch.intersects(query, overlaps.ptr());
+	batch.intersects_ray(ray_from, ray_dir, hits.ptr());
+
+	uint32_t visible = 0;
+	for (uint32_t i = 0; i < batch.size(); i++) {
+		AABB aabb = batch.get(i);
+		bool in_view = (culled[i / 64] >> (i % 64)) & 1;
+		visible += in_view;
+		if (in_view != aabb.intersects_convex_shape(planes, 6, points, 8) ||
+				bool((overlaps[i / 64] >> (i % 64)) & 1) != aabb.intersects(query) ||
+				bool((hits[i / 64] >> (i % 64)) & 1) != aabb.intersects_ray(ray_from, ray_dir)) {
+			return false;
+		}
+	}
+
+	LocalVector<uint32_t> indices;
+	indices.resize(batch.size());
+	return visible > 0 && visible < batch.size() && AABBBatch::mask_to_indices(culled.ptr(), batch.size(), indices.ptr()) == visible;
+}
+
+Dictionary Example::test_vector_stream() const {
+	// Points on a spiral, with the origin in the middle for normalize().
+	// 29 is not a multiple of any RealV::WIDTH, so every tail loop runs too.
+	PackedVector3Array a, b, c;
+	PackedVector2Array a2, b2, c2;
+	PackedVector4Array a4, b4, c4;
+	for (int i = 0; i < 29; i++) {
+		real_t angle = i * 0.7f;
+		a.push_back(i == 12 ? Vector3() : Vector3(Math::cos(angle) * i, i * 0.3f - 4, Math::sin(angle) * 2));
+		b.push_back(Vector3(1, -angle, 3 - i));
+		c.push_back(Vector3(angle, 0.5f, -i));
+		a2.push_back(Vector2(Math::sin(angle), i));
+		b2.push_back(Vector2(-i, 2));
+		c2.push_back(Vector2(3, -angle));
+		a4.push_back(i == 12 ? Vector4() : Vector4(i, Math::cos(angle), -2, angle));
+		b4.push_back(Vector4(0.5f, -i, angle, 1));
+		c4.push_back(Vector4(-angle, 2, i * 0.1f, 7));
+	}
+
+	// Operations every vector type has, each against its scalar operator.
+	int add_wrong = 0, sub_wrong = 0, mul_wrong = 0, mul_scalar_wrong = 0, fma_wrong = 0, length_wrong = 0;
+	auto check_elementwise = [&](const auto &p_a, const auto &p_b, const auto &p_c) {
+		using Packed = std::decay_t<decltype(p_a)>;
+		Packed added, subtracted, multiplied, scaled, fused;
+		added.resize(p_a.size());
+		subtracted.resize(p_a.size());
+		multiplied.resize(p_a.size());
+		scaled.resize(p_a.size());
+		fused.resize(p_a.size());
+		LocalVector<real_t> lengths;
+		lengths.resize(p_a.size());
+
+		simd::add(p_a.view(), p_b.view(), added.mut_view());
+		simd::sub(p_a.view(), p_b.view(), subtracted.mut_view());
+		simd::mul(p_a.view(), p_b.view(), multiplied.mut_view());
+		simd::mul(p_a.view(), 1.5, scaled.mut_view());
+		simd::fma(p_a.view(), p_b.view(), p_c.view(), fused.mut_view());
+		simd::length(p_a.view(), Span<real_t>(lengths.ptr(), lengths.size()));
+
+		for (int i = 0; i < p_a.size(); i++) {
+			add_wrong += !added[i].is_equal_approx(p_a[i] + p_b[i]);
+			sub_wrong += !subtracted[i].is_equal_approx(p_a[i] - p_b[i]);
+			mul_wrong += !multiplied[i].is_equal_approx(p_a[i] * p_b[i]);
+			mul_scalar_wrong += !scaled[i].is_equal_approx(p_a[i] * real_t(1.5));
+			fma_wrong += !fused[i].is_equal_approx(p_a[i] * p_b[i] + p_c[i]);
+			length_wrong += !Math::is_equal_approx(lengths[i], p_a[i].length());
+		}
+	};
+	check_elementwise(a2, b2, c2);
+	check_elementwise(a, b, c);
+	check_elementwise(a4, b4, c4);
+
+	PackedVector3Array normalized, crossed;
+	normalized.resize(a.size());
+	crossed.resize(a.size());
+	PackedVector2Array lerped;
+	lerped.resize(a2.size());
+	LocalVector<real_t> dots;
+	dots.resize(a.size());
+
+	simd::normalize(a.view(), normalized.mut_view());
+	simd::cross(a.view(), b.view(), crossed.mut_view());
+	simd::dot(a.view(), b.view(), Span<real_t>(dots.ptr(), dots.size()));
+	simd::lerp(a2.view(), b2.view(), 0.25, lerped.mut_view());
+
+	// The Vector4 overloads of the same operations.
+	PackedVector4Array normalized4, lerped4;
+	normalized4.resize(a4.size());
+	lerped4.resize(a4.size());
+	LocalVector<real_t> dots4;
+	dots4.resize(a4.size());
+	simd::normalize(a4.view(), normalized4.mut_view());
+	simd::dot(a4.view(), b4.view(), Span<real_t>(dots4.ptr(), dots4.size()));
+	simd::lerp(a4.view(), b4.view(), 0.25, lerped4.mut_view());
+
+	int normalize_wrong = 0, cross_wrong = 0, dot_wrong = 0, lerp_wrong = 0;
+	for (int i = 0; i < a4.size(); i++) {
+		normalize_wrong += !normalized4[i].is_equal_approx(a4[i].normalized());
+		dot_wrong += !Math::is_equal_approx(dots4[i], a4[i].dot(b4[i]));
+		lerp_wrong += !lerped4[i].is_equal_approx(a4[i].lerp(b4[i], 0.25));
+	}
+	AABB bounds(a[0], Vector3());
+	Vector2 max = a2[0];
+	for (int i = 0; i < a.size(); i++) {
+		normalize_wrong += !normalized[i].is_equal_approx(a[i].normalized());
+		cross_wrong += !crossed[i].is_equal_approx(a[i].cross(b[i]));
+		dot_wrong += !Math::is_equal_approx(dots[i], a[i].dot(b[i]));
+		lerp_wrong += !lerped[i].is_equal_approx(a2[i].lerp(b2[i], 0.25));
+		bounds.expand_to(a[i]);
+		max = max.max(a2[i]);
+	}
+
+	Dictionary result;
+	result["normalize_wrong"] = normalize_wrong;
+	result["cross_wrong"] = cross_wrong;
+	result["dot_wrong"] = dot_wrong;
+	result["lerp_wrong"] = lerp_wrong;
+	result["add_wrong"] = add_wrong;
+	result["sub_wrong"] = sub_wrong;
+	result["mul_wrong"] = mul_wrong;
+	result["mul_scalar_wrong"] = mul_scalar_wrong;
+	result["fma_wrong"] = fma_wrong;
+	result["length_wrong"] = length_wrong;
+	AABB stream_bounds = simd::bounds(a.view());
+	result["bounds_matches"] = stream_bounds.position.is_equal_approx(bounds.position) && stream_bounds.size.is_equal_approx(bounds.size);
+	result["reduce_max_matches"] = simd::reduce_max(a2.view()).is_equal_approx(max);
+	return result;
+}
+
+Dictionary Example::test_quaternion_batch() const {
+	const int count = 23;
+	Quaternion from[count], to[count], slerped[count], approximated[count], nlerped[count];
+	real_t weights[count];
+	Basis bases[count];
+	for (int i = 0; i < count; i++) {
+		from[i] = Quaternion(Vector3(1, i, 2).normalized(), i * 0.2f);
+		// Every third pair is more than 180 degrees apart, so the sign has to be adjusted.
+		to[i] = Quaternion(Vector3(-i, 1, 0.5f).normalized(), i % 3 == 0 ? 5.5f : i * 0.1f);
+		weights[i] = (i % 11) / 10.0f;
+	}
+
+	Quaternion::slerp_batch(from, to, weights, slerped, count);
+	Quaternion::slerp_batch(from, to, weights, approximated, count, true);
+	Quaternion::nlerp_batch(from, to, weights, nlerped, count);
+	Basis::from_quaternion_batch(from, bases, count);
+
+	int slerp_wrong = 0, approximate_wrong = 0, nlerp_wrong = 0, basis_wrong = 0;
+	for (int i = 0; i < count; i++) {
+		Quaternion expected = from[i].slerp(to[i], weights[i]);
+		slerp_wrong += !slerped[i].is_equal_approx(expected);
+		// The approximation stays within 0.05 degrees (half of that between the quaternions).
+		approximate_wrong += (approximated[i] - expected).length() > Math::deg_to_rad(0.025f) || !approximated[i].is_normalized();
+		// nlerp only matches slerp at the ends.
+		nlerp_wrong += !nlerped[i].is_normalized() || ((weights[i] == 0 || weights[i] == 1) && !nlerped[i].is_equal_approx(expected));
+		basis_wrong += !bases[i].is_equal_approx(Basis(from[i]));
+	}
+
+	Dictionary result;
+	result["slerp_wrong"] = slerp_wrong;
+	result["approximate_wrong"] = approximate_wrong;
+	result["nlerp_wrong"] = nlerp_wrong;
+	result["basis_wrong"] = basis_wrong;
+	return result;
+}
+
+Dictionary Example::test_projection_batch() const {
+	const int count = 19;
+	Projection camera = Projection::create_perspective(70, 1.5f, 0.1f, 100) * Projection(Transform3D(Basis(Vector3(0, 1, 0), 0.3f), Vector3(1, 2, 3)).affine_inverse());
+	Vector3 points[count], projected[count];
+	Vector4 vectors[count], transformed[count];
+	Projection matrices[count], products[count], transform_products[count];
+	Transform3D transforms[count];
+	for (int i = 0; i < count; i++) {
+		// A 5 wide grid receding from the camera.
+		points[i] = Vector3(i % 5 - 2, i / 5 - 2, -1 - i * 0.4f);
+		vectors[i] = Vector4(points[i].x, points[i].y, points[i].z, i % 2);
+		transforms[i] = Transform3D(Basis(Vector3(1, i, 2).normalized(), i * 0.2f), Vector3(i, -1, 0.5f));
+		matrices[i] = Projection(transforms[i]) * Projection::create_orthogonal(-i - 1, i + 1, -1, 1, 0.1f, 10);
+	}
+
+	camera.xform_batch(points, projected, count);
+	camera.xform_batch(vectors, transformed, count);
+	camera.mul_batch(matrices, products, count);
+	camera.mul_batch(transforms, transform_products, count);
+
+	int point_wrong = 0, vector_wrong = 0, product_wrong = 0, transform_product_wrong = 0;
+	for (int i = 0; i < count; i++) {
+		point_wrong += !projected[i].is_equal_approx(camera.xform(points[i]));
+		vector_wrong += !transformed[i].is_equal_approx(camera.xform(vectors[i]));
+		Projection expected = camera * matrices[i];
+		Projection expected_transform = camera * Projection(transforms[i]);
+		bool product_equal = true, transform_product_equal = true;
+		for (int j = 0; j < 4; j++) {
+			product_equal = product_equal && products[i].columns[j].is_equal_approx(expected.columns[j]);
+			transform_product_equal = transform_product_equal && transform_products[i].columns[j].is_equal_approx(expected_transform.columns[j]);
+		}
+		product_wrong += !product_equal;
+		transform_product_wrong += !transform_product_equal;
+	}
+
+	// The destination may be the source.
+	camera.mul_batch(matrices, matrices, count);
+	int in_place_wrong = 0;
+	for (int i = 0; i < count; i++) {
+		bool equal = true;
+		for (int j = 0; j < 4; j++) {
+			equal = equal && matrices[i].columns[j].is_equal_approx(products[i].columns[j]);
+		}
+		in_place_wrong += !equal;
+	}
+
+	Dictionary result;
+	result["point_wrong"] = point_wrong;
+	result["vector_wrong"] = vector_wrong;
+	result["product_wrong"] = product_wrong;
+	result["transform_product_wrong"] = transform_product_wrong;
+	result["in_place_wrong"] = in_place_wrong;
+	return result;
+}
+
+bool Example::test_math_fast() const {
+	// The documented bounds, plus the error of the float libm results compared against.
+	const int count = 1000;
+	real_t xs[count], ys[count], sines[count], cosines[count], arcs[count], exps[count], rsqrts[count];
+	for (int i = 0; i < count; i++) {
+		xs[i] = (i - count / 2) * 0.37f;
+		ys[i] = (i % 7 - 3) * 1.5f;
+	}
+	// Vector versions, the remainder goes through the scalar ones.
+	int i = 0;
+	for (; i + simd::RealV::WIDTH <= count; i += simd::RealV::WIDTH) {
+		simd::RealV x = simd::RealV::load(xs + i);
+		simd::RealV y = simd::RealV::load(ys + i);
+		Math::fast::sin(x).store(sines + i);
+		Math::fast::cos(x).store(cosines + i);
+		Math::fast::atan2(y, x).store(arcs + i);
+		Math::fast::exp(x * simd::RealV::splat(0.1f)).store(exps + i);
+		Math::fast::rsqrt(y * y + simd::RealV::splat(0.5f)).store(rsqrts + i);
+	}
+	for (; i < count; i++) {
+		sines[i] = Math::fast::sin(xs[i]);
+		cosines[i] = Math::fast::cos(xs[i]);
+		arcs[i] = Math::fast::atan2(ys[i], xs[i]);
+		exps[i] = Math::fast::exp(xs[i] * 0.1f);
+		rsqrts[i] = Math::fast::rsqrt(ys[i] * ys[i] + 0.5f);
+	}
+
+	for (i = 0; i < count; i++) {
+		real_t e = Math::exp(xs[i] * 0.1f);
+		real_t r = 1 / Math::sqrt(ys[i] * ys[i] + 0.5f);
+		if (Math::abs(sines[i] - Math::sin(xs[i])) > 1e-6f || Math::abs(cosines[i] - Math::cos(xs[i])) > 1e-6f || Math::abs(arcs[i] - Math::atan2(ys[i], xs[i])) > 1e-6f) {
+			return false;
+		}
+		if (Math::abs(exps[i] - e) > e * 1e-6f || Math::abs(rsqrts[i] - r) > r * 1e-6f) {
+			return false;
+		}
+	}
+	if (Math::fast::atan2(0.0f, 0.0f) != 0 || Math::fast::exp(0.0f) != 1 || Math::fast::cos(0.0f) != 1) {
+		return false;
+	}
+
+	Vector3 v(3, -4, 12);
+	Quaternion q(1, 2, -2, 4);
+	return v.normalized_fast().is_equal_approx(v.normalized()) && Vector2(3, 4).normalized_fast().is_equal_approx(Vector2(0.6f, 0.8f)) &&
+			Vector4(1, 1, 1, 1).normalized_fast().is_equal_approx(Vector4(0.5f, 0.5f, 0.5f, 0.5f)) && q.normalized_fast().is_equal_approx(q.normalized()) &&
+			Vector3().normalized_fast() == Vector3();
+}
+
+// Every outer item starts a nested group, so workers fork from inside work functions and steal from each other.
+struct NestedPoolWork {
+	static constexpr uint32_t OUTER = 32;
+	static constexpr uint32_t INNER = 128;
+
+	WorkStealingPool *pool = nullptr;
+	std::atomic<uint32_t> runs[OUTER * INNER];
+	std::mutex mutex;
+	LocalVector<std::thread::id> threads;
+
+	void outer(uint32_t p_index, void *p_userdata) {
+		pool->do_work(INNER, this, &NestedPoolWork::inner, p_index);
+	}
+
+	void inner(uint32_t p_index, uint32_t p_outer) {
+		runs[p_outer * INNER + p_index].fetch_add(1, std::memory_order_relaxed);
+		// Slow enough that idle workers get to steal.
+		std::this_thread::sleep_for(std::chrono::microseconds(10));
+
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!threads.has(std::this_thread::get_id())) {
+			threads.push_back(std::this_thread::get_id());
+		}
+	}
+
+	// Items that did not run exactly p_expected times.
+	int count_wrong(uint32_t p_expected) const {
+		int wrong = 0;
+		for (uint32_t i = 0; i < OUTER * INNER; i++) {
+			wrong += runs[i].load() != p_expected;
+		}
+		return wrong;
+	}
+};
+
+Dictionary Example::test_work_stealing_pool() const {
+	Dictionary result;
+	WorkStealingPool pool;
+	pool.init(4);
+
+	NestedPoolWork work;
+	work.pool = &pool;
+	for (uint32_t i = 0; i < NestedPoolWork::OUTER * NestedPoolWork::INNER; i++) {
+		work.runs[i].store(0);
+	}
+
+	pool.do_work(NestedPoolWork::OUTER, &work, &NestedPoolWork::outer, (void *)nullptr);
+	result["do_work_wrong"] = work.count_wrong(1);
+
+	WorkStealingPool::GroupID group = pool.begin_work(NestedPoolWork::OUTER, &work, &NestedPoolWork::outer, (void *)nullptr);
+	pool.end_work(group);
+	result["begin_work_wrong"] = work.count_wrong(2);
+
+	pool.finish();
+	result["threads"] = work.threads.size();
+	return result;
+}
+
+Dictionary Example::test_arena() const {
+	Dictionary result;
+	Arena arena(1024);
+
+	// Knock the bump pointer off alignment before each aligned allocation.
+	int misaligned = 0;
+	for (size_t align = 1; align <= 256; align *= 2) {
+		arena.alloc(3, 1);
+		misaligned += (reinterpret_cast<uintptr_t>(arena.alloc(24, align)) % align) != 0;
+	}
+	result["misaligned"] = misaligned;
+
+	// Grow well past the first block, earlier allocations have to stay put.
+	Arena::Mark mark = arena.get_mark();
+	size_t used_at_mark = arena.get_used_bytes();
+	uint32_t *arrays[64];
+	for (uint32_t i = 0; i < 64; i++) {
+		arrays[i] = arena.alloc_array<uint32_t>(64);
+		for (uint32_t j = 0; j < 64; j++) {
+			arrays[i][j] = i;
+		}
+	}
+	int overwritten = 0;
+	for (uint32_t i = 0; i < 64; i++) {
+		for (uint32_t j = 0; j < 64; j++) {
+			overwritten += arrays[i][j] != i;
+		}
+	}
+	result["overwritten"] = overwritten;
+	result["grew"] = arena.get_reserved_bytes() >= 64 * 64 * sizeof(uint32_t);
+
+	// Released blocks are reused, the arena does not grow again for the same pattern.
+	size_t reserved = arena.get_reserved_bytes();
+	arena.reset_to(mark);
+	result["reset_to_used"] = arena.get_used_bytes() == used_at_mark;
+	for (uint32_t i = 0; i < 64; i++) {
+		arena.alloc_array<uint32_t>(64);
+	}
+	result["reused"] = arena.get_reserved_bytes() == reserved;
+
+	arena.reset();
+	result["reset_used"] = (int64_t)arena.get_used_bytes();
+	result["reset_reserved"] = arena.get_reserved_bytes() == reserved;
+	arena.free_memory();
+	result["freed_reserved"] = (int64_t)arena.get_reserved_bytes();
+	result["alloc_after_free"] = arena.alloc(16) != nullptr;
+
+	// Containers on the frame arena, everything goes away with the scope.
+	size_t frame_used = FrameArena::get().get_used_bytes();
+	{
+		FrameArena::Scope scope;
+		HashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, FrameArenaTypedAllocator<HashMapElement<int, int>>> map;
+		List<int, FrameArenaAllocator> list;
+		for (int i = 0; i < 1000; i++) {
+			map.insert(i, i * 2);
+			list.push_back(i);
+		}
+		map.erase(500);
+		int64_t sum = 0;
+		for (const KeyValue<int, int> &E : map) {
+			sum += E.value;
+		}
+		for (const int &E : list) {
+			sum += E;
+		}
+		// 2 * (0 + ... + 999) - 1000 for the map, 0 + ... + 999 for the list.
+		result["frame_containers_sum"] = sum;
+		result["frame_used"] = FrameArena::get().get_used_bytes() > frame_used;
+	}
+	result["frame_released"] = FrameArena::get().get_used_bytes() == frame_used;
+	return result;
+}
+
+Dictionary Example::test_memory_pool() const {
+	Dictionary result;
+	// Both ends of a few size classes, plus one size that is forwarded to Memory.
+	const size_t sizes[] = { 1, 16, 17, 48, 100, 256, 497, 512, 513 };
+	const uint32_t count = 300;
+	LocalVector<uint8_t *> blocks;
+
+	int misaligned = 0;
+	for (size_t size : sizes) {
+		for (uint32_t i = 0; i < count; i++) {
+			uint8_t *block = (uint8_t *)MemoryPool::alloc(size);
+			misaligned += (reinterpret_cast<uintptr_t>(block) % alignof(max_align_t)) != 0;
+			memset(block, uint8_t(blocks.size()), size);
+			blocks.push_back(block);
+		}
+	}
+	result["misaligned"] = misaligned;
+
+	// Only checked once everything is allocated, so overlapping blocks show up.
+	int overlapping = 0;
+	uint32_t index = 0;
+	for (size_t size : sizes) {
+		for (uint32_t i = 0; i < count; i++, index++) {
+			for (size_t j = 0; j < size; j++) {
+				if (blocks[index][j] != uint8_t(index)) {
+					overlapping++;
+					break;
+				}
+			}
+		}
+	}
+	result["overlapping"] = overlapping;
+
+	// Free on another thread, its cache is handed back when it exits.
+	std::thread thread([&]() {
+		uint32_t free_index = 0;
+		for (size_t size : sizes) {
+			for (uint32_t i = 0; i < count; i++, free_index++) {
+				MemoryPool::free(blocks[free_index], size);
+			}
+		}
+	});
+	thread.join();
+
+	// Other pooled containers may hold pages too (the node allocator outside debug builds),
+	// so only compare against what was reserved before.
+	const uint64_t reserved_before = MemoryPool::get_reserved_bytes();
+	result["reserved"] = reserved_before > 0;
+	MemoryPool::release_unused_pages();
+	const uint64_t reserved_after_release = MemoryPool::get_reserved_bytes();
+	result["released"] = reserved_after_release < reserved_before;
+
+	// Still usable afterwards, and a live block keeps its page.
+	void *block = MemoryPool::alloc(32);
+	result["alloc_after_release"] = block != nullptr;
+	MemoryPool::release_unused_pages();
+	const uint64_t reserved_with_live_block = MemoryPool::get_reserved_bytes();
+	result["live_block_kept"] = reserved_with_live_block >= reserved_after_release && reserved_with_live_block >= MemoryPool::PAGE_SIZE;
+	MemoryPool::free(block, 32);
+	MemoryPool::release_unused_pages();
+	result["second_release_restored"] = MemoryPool::get_reserved_bytes() == reserved_after_release;
+	return result;
+}
+
+Dictionary Example::test_flat_hash_map() const {
+	Dictionary result;
+	// Non-trivial values, so slots are really copied and destroyed on rehash.
+	FlatHashMap<int, LocalVector<int>> map;
+
+	for (int i = 0; i < 1000; i++) {
+		map.insert(i, { i, -i });
+	}
+	int missing = 0;
+	for (int i = 0; i < 1000; i++) {
+		const LocalVector<int> *value = map.getptr(i);
+		missing += value == nullptr || value->size() != 2 || (*value)[0] != i || (*value)[1] != -i;
+	}
+	result["size"] = map.size();
+	result["missing"] = missing;
+
+	for (int i = 0; i < 1000; i += 2) {
+		map.erase(i);
+	}
+	int wrong_after_erase = 0;
+	for (int i = 0; i < 1000; i++) {
+		wrong_after_erase += map.has(i) != (i % 2 == 1);
+	}
+	result["size_after_erase"] = map.size();
+	result["wrong_after_erase"] = wrong_after_erase;
+
+	// Forward, then backward from the last element visited.
+	LocalVector<int> forward;
+	for (const KeyValue<int, LocalVector<int>> &E : map) {
+		forward.push_back(E.key);
+	}
+	int backward_mismatches = 0;
+	uint32_t backward_count = 0;
+	for (FlatHashMap<int, LocalVector<int>>::Iterator it = map.find(forward[forward.size() - 1]); it; --it, backward_count++) {
+		backward_mismatches += backward_count >= forward.size() || it->key != forward[forward.size() - 1 - backward_count];
+	}
+	result["forward_count"] = forward.size();
+	result["backward_count"] = backward_count;
+	result["backward_mismatches"] = backward_mismatches;
+
+	// Copies are deep, moves leave the source empty.
+	FlatHashMap<int, LocalVector<int>> copy = map;
+	copy[1].push_back(7);
+	copy.erase(3);
+	result["copy_independent"] = map[1].size() == 2 && map.has(3) && copy[1].size() == 3 && !copy.has(3);
+	FlatHashMap<int, LocalVector<int>> moved = std::move(copy);
+	result["moved_size"] = moved.size();
+	result["moved_from_size"] = copy.size();
+
+	// Inserting values taken from the map itself, across many rehashes.
+	FlatHashMap<int, LocalVector<int>> chain;
+	chain.insert(0, { 42 });
+	for (int i = 1; i < 1000; i++) {
+		chain.insert(i, chain[i - 1]);
+	}
+	int chain_wrong = 0;
+	for (const KeyValue<int, LocalVector<int>> &E : chain) {
+		chain_wrong += E.value.size() != 1 || E.value[0] != 42;
+	}
+	result["chain_wrong"] = chain_wrong;
+
+	// Erasing the current element does not move the others.
+	uint32_t visited = 0;
+	uint32_t before_removal = map.size();
+	for (FlatHashMap<int, LocalVector<int>>::Iterator it = map.begin(); it; ++it, visited++) {
+		if (it->key % 3 == 0) {
+			map.remove(it);
+		}
+	}
+	int wrong_after_remove = 0;
+	for (int i = 1; i < 1000; i += 2) {
+		wrong_after_remove += map.has(i) != (i % 3 != 0);
+	}
+	result["visited_while_removing"] = visited == before_removal;
+	result["wrong_after_remove"] = wrong_after_remove;
+
+	// No rehash once enough room is reserved.
+	FlatHashMap<int, int> reserved;
+	reserved.reserve(5000);
+	uint32_t reserved_capacity = reserved.get_capacity();
+	for (int i = 0; i < 5000; i++) {
+		reserved.insert(i, i);
+	}
+	result["reserve_kept_capacity"] = reserved_capacity >= 5000 && reserved.get_capacity() == reserved_capacity;
+
+	// A sliding window of keys fills the table with tombstones, which have to be
+	// cleaned up in place instead of growing it.
+	FlatHashMap<int, int> window;
+	for (int i = 0; i < 100; i++) {
+		window.insert(i, i);
+	}
+	uint32_t window_capacity = window.get_capacity();
+	int window_wrong = 0;
+	for (int i = 100; i < 20000; i++) {
+		window.insert(i, i);
+		window.erase(i - 100);
+		window_wrong += !window.has(i - 99) || window.has(i - 100);
+	}
+	result["window_wrong"] = window_wrong;
+	result["window_kept_capacity"] = window.get_capacity() == window_capacity;
+
+	FlatHashSet<int> set;
+	for (int i = 0; i < 1000; i++) {
+		set.insert(i * 7);
+	}
+	for (int i = 0; i < 1000; i += 2) {
+		set.erase(i * 7);
+	}
+	int set_wrong = 0;
+	int64_t set_sum = 0;
+	for (int i = 0; i < 1000; i++) {
+		set_wrong += set.has(i * 7) != (i % 2 == 1);
+	}
+	for (const int &E : set) {
+		set_sum += E;
+	}
+	result["set_wrong"] = set_wrong;
+	// 7 * (1 + 3 + ... + 999)
+	result["set_sum"] = set_sum;
+	return result;
+}
+
+Dictionary Example::test_rid_owner() const {
+	Dictionary result;
+	// Small chunks, so the chunk table is replaced while the reader uses it.
+	RID_Owner<int64_t, true> owner(256);
+	const int64_t writer_count = 4;
+	const int64_t per_writer = 4000;
+
+	LocalVector<RID> stable;
+	for (int64_t i = 0; i < 64; i++) {
+		stable.push_back(owner.make_rid(i));
+	}
+
+	std::atomic<bool> writers_done = false;
+	std::atomic<int> stable_wrong = 0;
+	std::atomic<int> own_wrong = 0;
+	std::atomic<int> freed_wrong = 0;
+	LocalVector<RID> kept[writer_count];
+
+	std::thread reader([&]() {
+		do {
+			for (uint32_t i = 0; i < stable.size(); i++) {
+				const int64_t *value = owner.get_or_null(stable[i]);
+				stable_wrong += value == nullptr || *value != int64_t(i);
+			}
+		} while (!writers_done.load());
+	});
+
+	std::thread writers[writer_count];
+	for (int64_t t = 0; t < writer_count; t++) {
+		writers[t] = std::thread([&, t]() {
+			for (int64_t i = 0; i < per_writer; i++) {
+				int64_t expected = (t + 1) * 1000000 + i;
+				RID rid = owner.make_rid(expected);
+				const int64_t *value = owner.get_or_null(rid);
+				own_wrong += value == nullptr || *value != expected;
+				if (i % 2) {
+					owner.free(rid);
+					freed_wrong += owner.owns(rid) || owner.get_or_null(rid) != nullptr;
+				} else {
+					kept[t].push_back(rid);
+				}
+			}
+		});
+	}
+	for (std::thread &writer : writers) {
+		writer.join();
+	}
+	writers_done = true;
+	reader.join();
+
+	result["stable_wrong"] = stable_wrong.load();
+	result["own_wrong"] = own_wrong.load();
+	result["freed_wrong"] = freed_wrong.load();
+	result["count"] = owner.get_rid_count();
+
+	int kept_wrong = 0;
+	for (int64_t t = 0; t < writer_count; t++) {
+		for (uint32_t j = 0; j < kept[t].size(); j++) {
+			const int64_t *value = owner.get_or_null(kept[t][j]);
+			kept_wrong += value == nullptr || *value != (t + 1) * 1000000 + j * 2;
+			owner.free(kept[t][j]);
+		}
+	}
+	for (const RID &rid : stable) {
+		owner.free(rid);
+	}
+	result["kept_wrong"] = kept_wrong;
+	result["count_after_free"] = owner.get_rid_count();
+	return result;
+}
+
+Dictionary Example::test_string_name_literal() const {
+	Dictionary result;
+	// Both spellings name the same template instance, so the same interned object.
+	result["same_object"] = &SNAME("string_name_literal") == &"string_name_literal"_sn;
+	result["same_name"] = SNAME("string_name_literal") == StringName("string_name_literal");
+	result["hash_matches"] = sname_hash<"string_name_literal">() == StringName("string_name_literal").hash();
+	return result;
+}
+
+Dictionary Example::test_variant_batch() const {
+	Dictionary result;
+	const uint32_t count = 13;
+	bool bools[count];
+	int64_t ints[count];
+	double floats[count];
+	Vector3 vectors[count];
+	for (uint32_t i = 0; i < count; i++) {
+		bools[i] = i % 3 == 0;
+		ints[i] = int64_t(i) * 1000000007 - 5;
+		floats[i] = i * 0.25 - 1.0;
+		vectors[i] = Vector3(i, -real_t(i), i * 0.5f);
+	}
+
+	// Built into raw memory, then copied by the engine and compared by it.
+	auto check = [](const auto *p_values, Variant::Type p_type) {
+		alignas(Variant) uint8_t storage[count * sizeof(Variant)];
+		Variant *variants = reinterpret_cast<Variant *>(storage);
+		Variant::construct_batch(variants, p_values, count);
+		Array array;
+		for (uint32_t i = 0; i < count; i++) {
+			array.push_back(variants[i]);
+		}
+		int wrong = 0;
+		for (uint32_t i = 0; i < count; i++) {
+			const Variant expected = p_values[i];
+			wrong += variants[i].get_type() != p_type || array[i].get_type() != p_type || variants[i] != expected || array[i] != variants[i];
+		}
+		Variant::destroy_batch(variants, count);
+		return wrong;
+	};
+	result["bool_wrong"] = check(bools, Variant::BOOL);
+	result["int_wrong"] = check(ints, Variant::INT);
+	result["float_wrong"] = check(floats, Variant::FLOAT);
+	result["vector3_wrong"] = check(vectors, Variant::VECTOR3);
+	return result;
+}
+
 Callable Example::test_callable_mp() {
 	return callable_mp(this, &Example::unbound_method1);
 }
@@ -141,6 +141,20 @@ public:
 	TypedArray<PackedInt32Array> test_typed_array_of_packed() const;
 	int test_vector_ops() const;
 	int test_vector_init_list() const;
+	bool test_xform_batch() const;
+	bool test_aabb_batch() const;
+	Dictionary test_vector_stream() const;
+	Dictionary test_quaternion_batch() const;
+	Dictionary test_projection_batch() const;
+	bool test_math_fast() const;
+
+	Dictionary test_work_stealing_pool() const;
+	Dictionary test_arena() const;
+	Dictionary test_memory_pool() const;
+	Dictionary test_flat_hash_map() const;
+	Dictionary test_rid_owner() const;
+	Dictionary test_string_name_literal() const;
+	Dictionary test_variant_batch() const;
 
 	bool test_object_cast_to_node(Object *p_object) const;
 	bool test_object_cast_to_control(Object *p_object) const;
@@ -6,7 +6,11 @@
 #ifndef TESTS_H
 #define TESTS_H
 
+#include <godot_cpp/templates/arena.hpp>
 #include <godot_cpp/templates/cowdata.hpp>
+#include <godot_cpp/templates/flat_hash_map.hpp>
+#include <godot_cpp/templates/flat_hash_set.hpp>
+#include <godot_cpp/templates/flat_hash_table.hpp>
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
 #include <godot_cpp/templates/hashfuncs.hpp>
@@ -20,10 +24,12 @@
 #include <godot_cpp/templates/search_array.hpp>
 #include <godot_cpp/templates/self_list.hpp>
 #include <godot_cpp/templates/sort_array.hpp>
+#include <godot_cpp/templates/span.hpp>
 #include <godot_cpp/templates/spin_lock.hpp>
 #include <godot_cpp/templates/thread_work_pool.hpp>
 #include <godot_cpp/templates/vector.hpp>
 #include <godot_cpp/templates/vmap.hpp>
 #include <godot_cpp/templates/vset.hpp>
+#include <godot_cpp/templates/work_stealing_pool.hpp>
 
 #endif // TESTS_H
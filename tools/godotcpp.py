@@ -158,6 +158,7 @@ def scons_generate_bindings(target, source, env):
         "32" if "32" in env["arch"] else "64",
         env["precision"],
         env["godot_cpp_gen_dir"],
+        env["eager_method_binds"],
     )
     return None
 
@@ -275,6 +276,13 @@ def options(opts, env):
             default=env.get("generate_template_get_node", True),
         )
     )
+    opts.Add(
+        BoolVariable(
+            key="eager_method_binds",
+            help="Resolve all engine method binds in one pass at initialization, instead of on first call.",
+            default=env.get("eager_method_binds", False),
+        )
+    )
     opts.Add(
         BoolVariable(
             key="build_library",
@@ -336,6 +344,14 @@ def options(opts, env):
         )
     )
 
+    opts.Add(
+        BoolVariable(
+            key="startup_profiling",
+            help="Time the extension initialization phases and print a JSON report after each initialization level.",
+            default=env.get("startup_profiling", False),
+        )
+    )
+
     opts.Add(
         BoolVariable(
             "disable_exceptions", "Force disabling exception handling code", default=env.get("disable_exceptions", True)
@@ -452,6 +468,9 @@ def generate(env):
     if env.use_hot_reload:
         env.Append(CPPDEFINES=["HOT_RELOAD_ENABLED"])
 
+    if env["startup_profiling"]:
+        env.Append(CPPDEFINES=["STARTUP_PROFILING_ENABLED"])
+
     if env.editor_build:
         env.Append(CPPDEFINES=["TOOLS_ENABLED"])
 